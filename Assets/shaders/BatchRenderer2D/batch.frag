@@ -19,11 +19,75 @@ uniform sampler2D u_textures[MAX_TEXTURE_SLOTS];
 in vec2 v_uv;
 in vec4 v_color;
 flat in float v_tex_id;
+flat in float v_shape_id;
+flat in vec4 v_line_color;
+flat in highp vec4 v_sdf_size;
+flat in float v_line_width;
 
 layout(location = 0) out vec4 frag_color;
 
+// Shape ids match BatchRenderer2D::Shape
+const int SHAPE_TEXTURED = 0;
+const int SHAPE_CIRCLE = 1;
+
+float circle_sdf(vec2 p, float radius)
+{
+    return length(p) - radius;
+}
+
+float rectangle_sdf(vec2 p, vec2 half_size)
+{
+    vec2 d = abs(p) - half_size;
+    return length(max(d, 0.0)) + min(max(d.x, d.y), 0.0);
+}
+
+// Same shading as ImmediateRenderer2D/sdf.frag, with the per-draw uniforms read from the vertex
+vec4 sdf_color(int shape_id)
+{
+    vec2 scaled_pos = v_uv * v_sdf_size.zw;
+    vec2 half_dims = v_sdf_size.xy * 0.5;
+
+    float dist = shape_id == SHAPE_CIRCLE ? circle_sdf(scaled_pos, half_dims.x) : rectangle_sdf(scaled_pos, half_dims);
+    float edge_width = fwidth(dist);
+
+    float half_line_width = v_line_width * 0.5;
+    float inner_edge = -half_line_width;
+    float outer_edge = half_line_width;
+
+    vec4 shape_color;
+    if (v_line_color.a < 0.01)
+    {
+        shape_color = v_color;
+        outer_edge = 0.0;
+    }
+    else if (v_color.a < 0.01)
+    {
+        float line_mix = smoothstep(inner_edge, inner_edge + edge_width, dist);
+        shape_color = mix(vec4(0.0), v_line_color, line_mix);
+    }
+    else
+    {
+        float inner_mix = smoothstep(inner_edge, inner_edge + edge_width, dist);
+        shape_color = mix(v_color, v_line_color, inner_mix);
+    }
+
+    float outer_mix = smoothstep(outer_edge, outer_edge + edge_width, dist);
+    return mix(shape_color, vec4(0.0), outer_mix);
+}
+
 void main()
 {
+    int shape_id = int(v_shape_id + 0.5);
+    if (shape_id != SHAPE_TEXTURED)
+    {
+        frag_color = sdf_color(shape_id);
+        if (frag_color.a < 0.002)
+        {
+            discard;
+        }
+        return;
+    }
+
     int tex_index = int(v_tex_id + 0.5);
     vec4 tex_color;
 
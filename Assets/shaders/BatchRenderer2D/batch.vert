@@ -12,18 +12,30 @@ layout (location = 0) in vec2 a_position;
 layout (location = 1) in vec4 a_color;
 layout (location = 2) in vec2 a_tex_coord;
 layout (location = 3) in float a_tex_id;
+layout (location = 4) in float a_shape_id;
+layout (location = 5) in vec4 a_line_color;
+layout (location = 6) in vec4 a_sdf_size;
+layout (location = 7) in float a_line_width;
 
 uniform mat3 u_ndc_matrix;
 
 out vec2 v_uv;
 out vec4 v_color;
 flat out float v_tex_id;
+flat out float v_shape_id;
+flat out vec4 v_line_color;
+flat out highp vec4 v_sdf_size;
+flat out float v_line_width;
 
 void main()
 {
     v_uv = a_tex_coord;
     v_color = a_color;
     v_tex_id = a_tex_id;
+    v_shape_id = a_shape_id;
+    v_line_color = a_line_color;
+    v_sdf_size = a_sdf_size;
+    v_line_width = a_line_width;
     vec3 ndc_pos = u_ndc_matrix * vec3(a_position, 1.0); 
     gl_Position = vec4(ndc_pos.xy, 0.0, 1.0);
 }
@@ -16,12 +16,20 @@ layout (location = 4) in vec4 a_color;
 layout (location = 5) in vec2 a_uv_scale;     
 layout (location = 6) in vec2 a_uv_offset;   
 layout (location = 7) in int a_tex_id;
+layout (location = 8) in int a_shape_id;
+layout (location = 9) in vec4 a_line_color;
+layout (location = 10) in vec4 a_sdf_size;
+layout (location = 11) in float a_line_width;
 
 uniform mat3 u_ndc_matrix;
 
 out vec2 v_uv;
 flat out vec4 v_color;
 flat out int v_tex_id;
+flat out int v_shape_id;
+flat out vec4 v_line_color;
+flat out highp vec4 v_sdf_size;
+flat out float v_line_width;
 
 void main()
 {
@@ -36,4 +44,8 @@ void main()
 
     v_color = a_color;
     v_tex_id = a_tex_id;
+    v_shape_id = a_shape_id;
+    v_line_color = a_line_color;
+    v_sdf_size = a_sdf_size;
+    v_line_width = a_line_width;
 }
@@ -24,3 +24,9 @@ target_link_libraries(dependencies INTERFACE
     the_gsl
     the_stb
 )
+
+# std::thread for CS230::WorkerPool; the web build runs the pool's work inline
+if(NOT EMSCRIPTEN)
+    find_package(Threads REQUIRED)
+    target_link_libraries(dependencies INTERFACE Threads::Threads)
+endif()
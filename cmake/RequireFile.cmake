@@ -0,0 +1,10 @@
+# author Sungwoo Yang
+# date 2025 Fall
+# CS200 Computer Graphics I
+# copyright DigiPen Institute of Technology
+
+# Script mode: cmake -DREQUIRED_FILE=<path> -DREASON=<text> -P RequireFile.cmake
+# Fails the build step when a generated file that has to be shipped does not exist.
+if(NOT EXISTS "${REQUIRED_FILE}")
+    message(FATAL_ERROR "${REQUIRED_FILE} is missing. ${REASON}")
+endif()
@@ -65,7 +65,8 @@ namespace CS200
             frag_glsl.insert(first_newline + 1, define_line);
         }
 
-        m_Shader = OpenGL::CreateShader(std::string_view{ vertex_glsl }, std::string_view{ frag_glsl });
+        m_Shader           = OpenGL::CreateShader(std::string_view{ vertex_glsl }, std::string_view{ frag_glsl });
+        m_NDCMatrixUniform = OpenGL::GetUniform(m_Shader, "u_ndc_matrix");
         m_VBO    = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, MAX_VERTICES_PER_BATCH * sizeof(QuadVertex));
 
         std::vector<uint32_t> indices(MAX_INDICES_PER_BATCH);
@@ -87,7 +88,8 @@ namespace CS200
         m_EBO = OpenGL::CreateBuffer(OpenGL::BufferType::Indices, std::as_bytes(std::span{ indices }));
 
         OpenGL::VertexBuffer vboLayout{
-            m_VBO, { OpenGL::Attribute::Float2, OpenGL::Attribute::Float4, OpenGL::Attribute::Float2, OpenGL::Attribute::Float }
+            m_VBO, { OpenGL::Attribute::Float2, OpenGL::Attribute::Float4, OpenGL::Attribute::Float2, OpenGL::Attribute::Float, OpenGL::Attribute::Float, OpenGL::Attribute::Float4,
+                     OpenGL::Attribute::Float4, OpenGL::Attribute::Float }
         };
         m_VAO = OpenGL::CreateVertexArrayObject(vboLayout, m_EBO);
 
@@ -97,7 +99,7 @@ namespace CS200
         std::iota(samplers.begin(), samplers.end(), 0);
 
         GL::UseProgram(m_Shader.Shader);
-        GL::Uniform1iv(m_Shader.UniformLocations.at("u_textures[0]"), static_cast<GLsizei>(m_TextureSlots.size()), samplers.data());
+        GL::Uniform1iv(OpenGL::GetUniform(m_Shader, "u_textures[0]").Location, static_cast<GLsizei>(m_TextureSlots.size()), samplers.data());
         GL::UseProgram(0);
     }
 
@@ -108,15 +110,15 @@ namespace CS200
         GL::DeleteVertexArrays(1, &m_VAO);
         OpenGL::DestroyShader(m_Shader);
 
-        m_VBO           = 0;
-        m_EBO           = 0;
-        m_VAO           = 0;
-        m_Shader.Shader = 0;
+        m_VBO              = 0;
+        m_EBO              = 0;
+        m_VAO              = 0;
+        m_Shader.Shader    = 0;
+        m_NDCMatrixUniform = {};
     }
 
     void BatchRenderer2D::BeginScene(const Math::TransformationMatrix& view_projection)
     {
-        m_drawCallCount  = 0;
         m_ViewProjection = view_projection;
         StartBatch();
     }
@@ -143,15 +145,18 @@ namespace CS200
             GL::ActiveTexture(GL_TEXTURE0 + i);
             GL::BindTexture(GL_TEXTURE_2D, m_TextureSlots[i]);
         }
+        GL::ActiveTexture(GL_TEXTURE0);
 
         const auto gl_vp_matrix = Renderer2DUtils::to_opengl_mat3(m_ViewProjection);
-        GL::UniformMatrix3fv(m_Shader.UniformLocations.at("u_ndc_matrix"), 1, GL_FALSE, gl_vp_matrix.data());
+        GL::UniformMatrix3fv(m_NDCMatrixUniform.Location, 1, GL_FALSE, gl_vp_matrix.data());
 
         GL::DrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_IndexCount), GL_UNSIGNED_INT, nullptr);
-        m_drawCallCount++;
+        ++m_drawCallCount;
 
         GL::BindVertexArray(0);
         GL::UseProgram(0);
+
+        StartBatch();
     }
 
     void BatchRenderer2D::StartBatch()
@@ -161,6 +166,14 @@ namespace CS200
         m_TextureSlotIndex = 0;
     }
 
+    void BatchRenderer2D::ReserveQuad()
+    {
+        if (m_Vertices.size() + 4 > MAX_VERTICES_PER_BATCH)
+        {
+            Flush();
+        }
+    }
+
     float BatchRenderer2D::GetTextureSlot(OpenGL::TextureHandle texture)
     {
         for (uint32_t i = 0; i < m_TextureSlotIndex; ++i)
@@ -174,7 +187,6 @@ namespace CS200
         if (m_TextureSlotIndex >= m_TextureSlots.size())
         {
             Flush();
-            StartBatch();
         }
 
         m_TextureSlots[m_TextureSlotIndex] = texture;
@@ -184,11 +196,7 @@ namespace CS200
 
     void BatchRenderer2D::DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor)
     {
-        if (m_Vertices.size() + 4 > MAX_VERTICES_PER_BATCH)
-        {
-            Flush();
-            StartBatch();
-        }
+        ReserveQuad();
 
         const float texID = GetTextureSlot(texture);
         const auto  color = CS200::unpack_color(tintColor);
@@ -202,32 +210,67 @@ namespace CS200
 
         for (size_t i = 0; i < 4; ++i)
         {
-            QuadVertex vertex;
+            QuadVertex vertex{};
             Math::vec2 local_pos = { static_cast<double>(s_UnitQuadPositions[i][0]), static_cast<double>(s_UnitQuadPositions[i][1]) };
             Math::vec2 world_pos = transform * local_pos;
             vertex.Position      = { static_cast<float>(world_pos.x), static_cast<float>(world_pos.y) };
             vertex.TintColor     = color;
             vertex.TexCoord      = texCoords[i];
             vertex.TexID         = texID;
+            vertex.ShapeID       = static_cast<float>(Shape::Textured);
             m_Vertices.push_back(vertex);
         }
 
         m_IndexCount += 6;
     }
 
-    void BatchRenderer2D::DrawCircle(const Math::TransformationMatrix&, CS200::RGBA, CS200::RGBA, double)
+    void BatchRenderer2D::DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width)
+    {
+        DrawSDF(transform, fill_color, line_color, line_width, Shape::Circle);
+    }
+
+    void BatchRenderer2D::DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width)
     {
+        DrawSDF(transform, fill_color, line_color, line_width, Shape::Rectangle);
     }
 
-    void BatchRenderer2D::DrawRectangle(const Math::TransformationMatrix&, CS200::RGBA, CS200::RGBA, double)
+    void BatchRenderer2D::DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width)
     {
+        const auto line_transform = Renderer2DUtils::CalculateLineTransform(transform, start_point, end_point, line_width);
+        DrawSDF(line_transform, line_color, line_color, line_width, Shape::Rectangle);
     }
 
-    void BatchRenderer2D::DrawLine(const Math::TransformationMatrix&, Math::vec2, Math::vec2, CS200::RGBA, double)
+    void BatchRenderer2D::DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width)
     {
+        DrawLine(Math::TransformationMatrix{}, start_point, end_point, line_color, line_width);
     }
 
-    void BatchRenderer2D::DrawLine(Math::vec2, Math::vec2, CS200::RGBA, double)
+    void BatchRenderer2D::DrawSDF(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, Shape shape)
     {
+        ReserveQuad();
+
+        // Same padded quad the immediate renderer draws, transformed here instead of in the vertex shader
+        const auto  sdf_transform = Renderer2DUtils::CalculateSDFTransform(transform, line_width);
+        const auto& q             = sdf_transform.QuadTransform;
+        const auto  fill          = CS200::unpack_color(fill_color);
+        const auto  line          = CS200::unpack_color(line_color);
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            const float x = s_UnitQuadPositions[i][0];
+            const float y = s_UnitQuadPositions[i][1];
+
+            QuadVertex vertex{};
+            vertex.Position  = { q[0] * x + q[3] * y + q[6], q[1] * x + q[4] * y + q[7] };
+            vertex.TintColor = fill;
+            vertex.TexCoord  = s_UnitQuadPositions[i];
+            vertex.ShapeID   = static_cast<float>(shape);
+            vertex.LineColor = line;
+            vertex.SDFSize   = { sdf_transform.WorldSize[0], sdf_transform.WorldSize[1], sdf_transform.QuadSize[0], sdf_transform.QuadSize[1] };
+            vertex.LineWidth = static_cast<float>(line_width);
+            m_Vertices.push_back(vertex);
+        }
+
+        m_IndexCount += 6;
     }
-}
\ No newline at end of file
+}
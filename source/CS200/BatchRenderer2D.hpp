@@ -12,10 +12,18 @@
 #include "OpenGL/Shader.hpp"
 #include "OpenGL/VertexArray.hpp"
 #include <array>
+#include <cstdint>
 #include <vector>
 
 namespace CS200
 {
+    /**
+     * \brief 2D renderer that collects quads, circles, rectangles and lines into one vertex buffer
+     *
+     * Every primitive becomes four pre-transformed vertices in a shared buffer, so textured sprites
+     * and SDF shapes stay in submission order and a whole scene usually goes out in one draw call.
+     * A batch is flushed when the buffer or the texture slots run out, on EndScene() and on Flush().
+     */
     class BatchRenderer2D : public IRenderer2D
     {
     public:
@@ -31,6 +39,7 @@ namespace CS200
         void Shutdown() override;
         void BeginScene(const Math::TransformationMatrix& view_projection) override;
         void EndScene() override;
+        void Flush() override;
         void DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor) override;
 
         void DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width) override;
@@ -38,36 +47,58 @@ namespace CS200
         void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width) override;
         void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width) override;
 
+        uint64_t GetDrawCallCount() const override
+        {
+            return m_drawCallCount;
+        }
+
     private:
-        void  Flush();
+        // Kept in sync with the shape switch in batch.frag
+        enum class Shape : uint8_t
+        {
+            Textured  = 0,
+            Circle    = 1,
+            Rectangle = 2,
+        };
+
         void  StartBatch();
+        void  ReserveQuad();
         float GetTextureSlot(OpenGL::TextureHandle texture);
+        void  DrawSDF(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, Shape shape);
 
+        // TexCoord holds the texture coordinate for sprites and the unit quad position for SDF shapes.
+        // LineColor, SDFSize (world size xy, quad size zw) and LineWidth are only read for SDF shapes.
         struct QuadVertex
         {
             std::array<float, 2> Position;
             std::array<float, 4> TintColor;
             std::array<float, 2> TexCoord;
             float                TexID;
+            float                ShapeID;
+            std::array<float, 4> LineColor;
+            std::array<float, 4> SDFSize;
+            float                LineWidth;
         };
 
         OpenGL::VertexArrayHandle m_VAO = 0;
         OpenGL::BufferHandle      m_VBO = 0;
         OpenGL::BufferHandle      m_EBO = 0;
         OpenGL::CompiledShader    m_Shader{};
+        OpenGL::UniformHandle     m_NDCMatrixUniform{};
 
         std::vector<QuadVertex> m_Vertices;
         uint32_t                m_IndexCount = 0;
 
         std::vector<OpenGL::TextureHandle> m_TextureSlots;
-        uint32_t                           m_TextureSlotIndex = 1;
+        uint32_t                           m_TextureSlotIndex = 0;
 
         static constexpr uint32_t MAX_QUADS_PER_BATCH    = 10000;
         static constexpr uint32_t MAX_VERTICES_PER_BATCH = MAX_QUADS_PER_BATCH * 4;
         static constexpr uint32_t MAX_INDICES_PER_BATCH  = MAX_QUADS_PER_BATCH * 6;
 
         Math::TransformationMatrix m_ViewProjection{};
+        uint64_t                   m_drawCallCount = 0;
 
         static const std::array<std::array<float, 2>, 4> s_UnitQuadPositions;
     };
-}
\ No newline at end of file
+}
@@ -10,6 +10,7 @@
 #include "Engine/Vec2.hpp"
 #include "OpenGL/Texture.hpp"
 #include "RGBA.hpp"
+#include <cstdint>
 
 namespace Math
 {
@@ -124,6 +125,27 @@ namespace CS200
          */
         virtual void EndScene() = 0;
 
+        /**
+         * \brief Submit any geometry the renderer is still holding
+         *
+         * Call before issuing raw OpenGL draws inside a BeginScene()/EndScene() pair so they
+         * land after everything drawn through the renderer so far. Immediate renderers have
+         * nothing queued and leave this as a no-op.
+         */
+        virtual void Flush()
+        {
+        }
+
+        /**
+         * \brief Total number of draw calls this renderer has issued since it was created
+         *
+         * Renderers that do not track it report 0.
+         */
+        virtual uint64_t GetDrawCallCount() const
+        {
+            return 0;
+        }
+
         /**
          * \brief Draw a textured quadrilateral with transformation and tinting
          * \param transform World transformation matrix (position, rotation, scale)
@@ -7,6 +7,7 @@
  */
 #include "ImGuiHelper.hpp"
 
+#include "OpenGL/GL.hpp"
 #include <SDL.h>
 #include <backends/imgui_impl_opengl3.h>
 #include <backends/imgui_impl_sdl2.h>
@@ -41,6 +42,13 @@ namespace ImGuiHelper
         ImGui_ImplOpenGL3_Init();
     }
 
+    void InitializeHeadless()
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = nullptr;
+    }
+
     void FeedEvent(const SDL_Event& event)
     {
         ImGui_ImplSDL2_ProcessEvent(&event);
@@ -98,12 +106,17 @@ namespace ImGuiHelper
             ImGui::RenderPlatformWindowsDefault();
             SDL_GL_MakeCurrent(gCachedWindow, gCachedGLContext);
         }
+        // The backend drives OpenGL directly, so the wrapper's view of bound state can't be trusted past here
+        GL::InvalidateStateCache();
     }
 
     void Shutdown()
     {
-        ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplSDL2_Shutdown();
+        if (gCachedWindow != nullptr)
+        {
+            ImGui_ImplOpenGL3_Shutdown();
+            ImGui_ImplSDL2_Shutdown();
+        }
         ImGui::DestroyContext();
 
         gCachedWindow    = nullptr;
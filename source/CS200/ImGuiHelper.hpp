@@ -17,6 +17,8 @@ union SDL_Event;
 namespace ImGuiHelper
 {
     void Initialize(gsl::not_null<SDL_Window*> sdl_window, gsl::not_null<SDL_GLContext> gl_context, const std::filesystem::path& ini_file_path = "imgui.ini");
+    // Context only, no platform/renderer backends: ImGui::GetIO() works, nothing is ever drawn
+    void InitializeHeadless();
     void FeedEvent(const SDL_Event& event);
 
     struct Viewport
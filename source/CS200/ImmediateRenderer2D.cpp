@@ -18,8 +18,8 @@
 namespace CS200
 {
     ImmediateRenderer2D::ImmediateRenderer2D(ImmediateRenderer2D&& other) noexcept
-        : quad(std::exchange(other.quad, {})), quadShader(std::exchange(other.quadShader, {})), sdfQuad(std::exchange(other.sdfQuad, {})), sdfShader(std::exchange(other.sdfShader, {})),
-          view_projection(std::exchange(other.view_projection, {}))
+        : quad(std::exchange(other.quad, {})), quadShader(std::exchange(other.quadShader, {})), quadUniforms(std::exchange(other.quadUniforms, {})), sdfQuad(std::exchange(other.sdfQuad, {})),
+          sdfShader(std::exchange(other.sdfShader, {})), sdfUniforms(std::exchange(other.sdfUniforms, {})), view_projection(std::exchange(other.view_projection, {})), drawCallCount(std::exchange(other.drawCallCount, 0))
     {
     }
 
@@ -27,9 +27,12 @@ namespace CS200
     {
         std::swap(quad, other.quad);
         std::swap(quadShader, other.quadShader);
+        std::swap(quadUniforms, other.quadUniforms);
         std::swap(sdfQuad, other.sdfQuad);
         std::swap(sdfShader, other.sdfShader);
+        std::swap(sdfUniforms, other.sdfUniforms);
         std::swap(view_projection, other.view_projection);
+        std::swap(drawCallCount, other.drawCallCount);
         return *this;
     }
 
@@ -62,6 +65,10 @@ namespace CS200
         quad.vertexArray = OpenGL::CreateVertexArrayObject(layout, quad.indexBuffer);
 
         quadShader = OpenGL::CreateShader(std::filesystem::path{ "Assets/shaders/ImmediateRenderer2D/quad.vert" }, std::filesystem::path{ "Assets/shaders/ImmediateRenderer2D/quad.frag" });
+        quadUniforms.NDCMatrix   = OpenGL::GetUniform(quadShader, "u_ndc_matrix");
+        quadUniforms.ModelMatrix = OpenGL::GetUniform(quadShader, "u_model_matrix");
+        quadUniforms.UVMatrix    = OpenGL::GetUniform(quadShader, "u_uv_matrix");
+        quadUniforms.TintColor   = OpenGL::GetUniform(quadShader, "u_tint_color");
 
         struct SDFVertex
         {
@@ -83,6 +90,14 @@ namespace CS200
         sdfQuad.vertexArray = OpenGL::CreateVertexArrayObject(sdf_layout, sdfQuad.indexBuffer);
 
         sdfShader = OpenGL::CreateShader(std::filesystem::path{ "Assets/shaders/ImmediateRenderer2D/sdf.vert" }, std::filesystem::path{ "Assets/shaders/ImmediateRenderer2D/sdf.frag" });
+        sdfUniforms.NDCMatrix   = OpenGL::GetUniform(sdfShader, "u_ndc_matrix");
+        sdfUniforms.ModelMatrix = OpenGL::GetUniform(sdfShader, "u_model_matrix");
+        sdfUniforms.WorldSize   = OpenGL::GetUniform(sdfShader, "u_world_size");
+        sdfUniforms.QuadSize    = OpenGL::GetUniform(sdfShader, "u_quad_size");
+        sdfUniforms.FillColor   = OpenGL::GetUniform(sdfShader, "u_fill_color");
+        sdfUniforms.LineColor   = OpenGL::GetUniform(sdfShader, "u_line_color");
+        sdfUniforms.LineWidth   = OpenGL::GetUniform(sdfShader, "u_line_width");
+        sdfUniforms.ShapeType   = OpenGL::GetUniform(sdfShader, "u_shape_type");
     }
 
     void ImmediateRenderer2D::Shutdown()
@@ -91,12 +106,14 @@ namespace CS200
         GL::DeleteBuffers(1, &quad.indexBuffer);
         GL::DeleteVertexArrays(1, &quad.vertexArray);
         OpenGL::DestroyShader(quadShader);
-        quad = {};
+        quadUniforms = {};
+        quad         = {};
 
         GL::DeleteBuffers(1, &sdfQuad.vertexBuffer);
         GL::DeleteVertexArrays(1, &sdfQuad.vertexArray);
         OpenGL::DestroyShader(sdfShader);
-        sdfQuad = {};
+        sdfUniforms = {};
+        sdfQuad     = {};
     }
 
     void ImmediateRenderer2D::BeginScene(const Math::TransformationMatrix& view_projection_matrix)
@@ -105,16 +122,19 @@ namespace CS200
         const auto to_ndc_opengl = Renderer2DUtils::to_opengl_mat3(view_projection);
 
         GL::UseProgram(quadShader.Shader);
-        GL::UniformMatrix3fv(quadShader.UniformLocations.at("u_ndc_matrix"), 1, GL_FALSE, to_ndc_opengl.data());
+        GL::UniformMatrix3fv(quadUniforms.NDCMatrix.Location, 1, GL_FALSE, to_ndc_opengl.data());
 
         GL::UseProgram(sdfShader.Shader);
-        GL::UniformMatrix3fv(sdfShader.UniformLocations.at("u_ndc_matrix"), 1, GL_FALSE, to_ndc_opengl.data());
-
-        GL::UseProgram(0);
+        GL::UniformMatrix3fv(sdfUniforms.NDCMatrix.Location, 1, GL_FALSE, to_ndc_opengl.data());
     }
 
     void ImmediateRenderer2D::EndScene()
     {
+        // Draws leave their program, vertex array and texture bound so back-to-back draws of the same
+        // kind cost no state changes; hand a clean state to whatever runs after the scene
+        GL::BindTexture(GL_TEXTURE_2D, 0);
+        GL::BindVertexArray(0);
+        GL::UseProgram(0);
     }
 
     void ImmediateRenderer2D::DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor)
@@ -123,9 +143,8 @@ namespace CS200
         GL::BindVertexArray(quad.vertexArray);
         GL::BindTexture(GL_TEXTURE_2D, texture);
 
-        const auto& locations    = quadShader.UniformLocations;
-        const auto  model_matrix = Renderer2DUtils::to_opengl_mat3(transform);
-        GL::UniformMatrix3fv(locations.at("u_model_matrix"), 1, GL_FALSE, model_matrix.data());
+        const auto model_matrix = Renderer2DUtils::to_opengl_mat3(transform);
+        GL::UniformMatrix3fv(quadUniforms.ModelMatrix.Location, 1, GL_FALSE, model_matrix.data());
 
         Math::TransformationMatrix uv_transform;
         uv_transform[0][0]   = texture_coord_tr.x - texture_coord_bl.x;
@@ -133,16 +152,13 @@ namespace CS200
         uv_transform[0][2]   = texture_coord_bl.x;
         uv_transform[1][2]   = texture_coord_bl.y;
         const auto uv_matrix = Renderer2DUtils::to_opengl_mat3(uv_transform);
-        GL::UniformMatrix3fv(locations.at("u_uv_matrix"), 1, GL_FALSE, uv_matrix.data());
+        GL::UniformMatrix3fv(quadUniforms.UVMatrix.Location, 1, GL_FALSE, uv_matrix.data());
 
         const auto color = unpack_color(tintColor);
-        GL::Uniform4fv(locations.at("u_tint_color"), 1, color.data());
+        GL::Uniform4fv(quadUniforms.TintColor.Location, 1, color.data());
 
         GL::DrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
-
-        GL::BindTexture(GL_TEXTURE_2D, 0);
-        GL::BindVertexArray(0);
-        GL::UseProgram(0);
+        ++drawCallCount;
     }
 
     void ImmediateRenderer2D::DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width)
@@ -171,24 +187,20 @@ namespace CS200
         GL::UseProgram(sdfShader.Shader);
         GL::BindVertexArray(sdfQuad.vertexArray);
 
-        const auto& locations = sdfShader.UniformLocations;
-
         const auto sdf_transform_info = Renderer2DUtils::CalculateSDFTransform(transform, line_width);
 
-        GL::UniformMatrix3fv(locations.at("u_model_matrix"), 1, GL_FALSE, sdf_transform_info.QuadTransform.data());
-        GL::Uniform2fv(locations.at("u_world_size"), 1, sdf_transform_info.WorldSize.data());
-        GL::Uniform2fv(locations.at("u_quad_size"), 1, sdf_transform_info.QuadSize.data());
+        GL::UniformMatrix3fv(sdfUniforms.ModelMatrix.Location, 1, GL_FALSE, sdf_transform_info.QuadTransform.data());
+        GL::Uniform2fv(sdfUniforms.WorldSize.Location, 1, sdf_transform_info.WorldSize.data());
+        GL::Uniform2fv(sdfUniforms.QuadSize.Location, 1, sdf_transform_info.QuadSize.data());
 
         const auto fill = unpack_color(fill_color);
         const auto line = unpack_color(line_color);
-        GL::Uniform4fv(locations.at("u_fill_color"), 1, fill.data());
-        GL::Uniform4fv(locations.at("u_line_color"), 1, line.data());
-        GL::Uniform1f(locations.at("u_line_width"), static_cast<float>(line_width));
-        GL::Uniform1i(locations.at("u_shape_type"), static_cast<int>(sdf_shape));
+        GL::Uniform4fv(sdfUniforms.FillColor.Location, 1, fill.data());
+        GL::Uniform4fv(sdfUniforms.LineColor.Location, 1, line.data());
+        GL::Uniform1f(sdfUniforms.LineWidth.Location, static_cast<float>(line_width));
+        GL::Uniform1i(sdfUniforms.ShapeType.Location, static_cast<int>(sdf_shape));
 
         GL::DrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
-
-        GL::BindVertexArray(0);
-        GL::UseProgram(0);
+        ++drawCallCount;
     }
 }
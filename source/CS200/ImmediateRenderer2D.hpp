@@ -34,7 +34,7 @@ namespace CS200
      * 1. Init() - Set up OpenGL resources (shaders, buffers, vertex arrays)
      * 2. BeginScene() - Set camera/view matrix for the frame
      * 3. Draw*() calls - Render individual primitives immediately
-     * 4. EndScene() - Finalize the frame (currently no-op)
+     * 4. EndScene() - Unbind the program, vertex array and texture the draws left bound
      * 5. Shutdown() - Clean up OpenGL resources
      *
      * Technical Implementation:
@@ -175,11 +175,12 @@ namespace CS200
         void BeginScene(const Math::TransformationMatrix& view_projection) override;
 
         /**
-         * \brief End the current frame (currently no operations needed)
+         * \brief End the current frame and unbind the renderer's OpenGL state
          *
          * Implementation notes:
-         * - No cleanup or finalization needed for immediate mode
-         * - Could be used for debugging/profiling in future
+         * - Draw calls leave their shader, vertex array and texture bound so the GL:: state
+         *   cache can skip rebinding them on the next draw of the same kind
+         * - Unbinds all three here so code running after the scene starts from a clean state
          */
         void EndScene() override;
 
@@ -256,6 +257,14 @@ namespace CS200
          */
         void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width) override;
 
+        /**
+         * \brief Number of glDrawElements calls issued so far (one per primitive)
+         */
+        uint64_t GetDrawCallCount() const override
+        {
+            return drawCallCount;
+        }
+
     private:
         // SDF Shape identifiers - must be kept in sync with sdf.frag shader
         enum class SDFShape : uint8_t
@@ -288,9 +297,33 @@ namespace CS200
             OpenGL::VertexArrayHandle vertexArray{ 0 };
         } quad;
 
+        // Uniform handles resolved in Init() so the draw path never looks a name up
+        struct QuadUniforms
+        {
+            OpenGL::UniformHandle NDCMatrix;
+            OpenGL::UniformHandle ModelMatrix;
+            OpenGL::UniformHandle UVMatrix;
+            OpenGL::UniformHandle TintColor;
+        };
+
+        struct SDFUniforms
+        {
+            OpenGL::UniformHandle NDCMatrix;
+            OpenGL::UniformHandle ModelMatrix;
+            OpenGL::UniformHandle WorldSize;
+            OpenGL::UniformHandle QuadSize;
+            OpenGL::UniformHandle FillColor;
+            OpenGL::UniformHandle LineColor;
+            OpenGL::UniformHandle LineWidth;
+            OpenGL::UniformHandle ShapeType;
+        };
+
         OpenGL::CompiledShader     quadShader{};
+        QuadUniforms               quadUniforms{};
         Quad                       sdfQuad;
         OpenGL::CompiledShader     sdfShader{};
+        SDFUniforms                sdfUniforms{};
         Math::TransformationMatrix view_projection;
+        uint64_t                   drawCallCount = 0;
     };
 }
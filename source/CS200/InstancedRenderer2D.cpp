@@ -73,7 +73,8 @@ namespace CS200
             frag_glsl.insert(first_newline + 1, define_line);
         }
 
-        m_Shader = OpenGL::CreateShader(std::string_view{ vertex_glsl }, std::string_view{ frag_glsl });
+        m_Shader           = OpenGL::CreateShader(std::string_view{ vertex_glsl }, std::string_view{ frag_glsl });
+        m_NDCMatrixUniform = OpenGL::GetUniform(m_Shader, "u_ndc_matrix");
 
         m_UnitQuadVBO = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, std::as_bytes(std::span{ g_UnitQuadVertices }));
         m_InstanceVBO = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, MAX_INSTANCES_PER_BATCH * sizeof(InstanceData));
@@ -87,9 +88,11 @@ namespace CS200
         auto inst_float4 = OpenGL::Attribute::Float4;
         auto inst_float2 = OpenGL::Attribute::Float2;
         auto inst_int    = OpenGL::Attribute::Int;
+        auto inst_float  = OpenGL::Attribute::Float;
 
         OpenGL::VertexBuffer instanceLayout{
-            m_InstanceVBO, { inst_float3.WithDivisor(1), inst_float3.WithDivisor(1), inst_float4.WithDivisor(1), inst_float2.WithDivisor(1), inst_float2.WithDivisor(1), inst_int.WithDivisor(1) }
+            m_InstanceVBO, { inst_float3.WithDivisor(1), inst_float3.WithDivisor(1), inst_float4.WithDivisor(1), inst_float2.WithDivisor(1), inst_float2.WithDivisor(1), inst_int.WithDivisor(1),
+                             inst_int.WithDivisor(1), inst_float4.WithDivisor(1), inst_float4.WithDivisor(1), inst_float.WithDivisor(1) }
         };
 
         m_VAO = OpenGL::CreateVertexArrayObject({ unitQuadLayout, instanceLayout }, m_EBO);
@@ -98,7 +101,7 @@ namespace CS200
         std::iota(samplers.begin(), samplers.end(), 0);
 
         GL::UseProgram(m_Shader.Shader);
-        GL::Uniform1iv(m_Shader.UniformLocations.at("u_textures[0]"), static_cast<GLsizei>(m_TextureSlots.size()), samplers.data());
+        GL::Uniform1iv(OpenGL::GetUniform(m_Shader, "u_textures[0]").Location, static_cast<GLsizei>(m_TextureSlots.size()), samplers.data());
         GL::UseProgram(0);
     }
 
@@ -110,16 +113,16 @@ namespace CS200
         GL::DeleteVertexArrays(1, &m_VAO);
         OpenGL::DestroyShader(m_Shader);
 
-        m_UnitQuadVBO   = 0;
-        m_InstanceVBO   = 0;
-        m_EBO           = 0;
-        m_VAO           = 0;
-        m_Shader.Shader = 0;
+        m_UnitQuadVBO      = 0;
+        m_InstanceVBO      = 0;
+        m_EBO              = 0;
+        m_VAO              = 0;
+        m_Shader.Shader    = 0;
+        m_NDCMatrixUniform = {};
     }
 
     void InstancedRenderer2D::BeginScene(const Math::TransformationMatrix& view_projection)
     {
-        m_drawCallCount  = 0;
         m_ViewProjection = view_projection;
         StartBatch();
     }
@@ -146,15 +149,18 @@ namespace CS200
             GL::ActiveTexture(GL_TEXTURE0 + i);
             GL::BindTexture(GL_TEXTURE_2D, m_TextureSlots[i]);
         }
+        GL::ActiveTexture(GL_TEXTURE0);
 
         const auto gl_vp_matrix = Renderer2DUtils::to_opengl_mat3(m_ViewProjection);
-        GL::UniformMatrix3fv(m_Shader.UniformLocations.at("u_ndc_matrix"), 1, GL_FALSE, gl_vp_matrix.data());
+        GL::UniformMatrix3fv(m_NDCMatrixUniform.Location, 1, GL_FALSE, gl_vp_matrix.data());
 
         GL::DrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(m_InstanceCount));
-        m_drawCallCount++;
+        ++m_drawCallCount;
 
         GL::BindVertexArray(0);
         GL::UseProgram(0);
+
+        StartBatch();
     }
 
     void InstancedRenderer2D::StartBatch()
@@ -164,6 +170,14 @@ namespace CS200
         m_TextureSlotIndex = 0;
     }
 
+    void InstancedRenderer2D::ReserveInstance()
+    {
+        if (m_InstanceCount >= MAX_INSTANCES_PER_BATCH)
+        {
+            Flush();
+        }
+    }
+
     int InstancedRenderer2D::GetTextureSlot(OpenGL::TextureHandle texture)
     {
         for (uint32_t i = 0; i < m_TextureSlotIndex; ++i)
@@ -177,7 +191,6 @@ namespace CS200
         if (m_TextureSlotIndex >= m_TextureSlots.size())
         {
             Flush();
-            StartBatch();
         }
 
         m_TextureSlots[m_TextureSlotIndex] = texture;
@@ -186,13 +199,9 @@ namespace CS200
 
     void InstancedRenderer2D::DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor)
     {
-        if (m_InstanceCount >= MAX_INSTANCES_PER_BATCH)
-        {
-            Flush();
-            StartBatch();
-        }
+        ReserveInstance();
 
-        InstanceData data;
+        InstanceData data{};
 
         data.ModelRow0 = { static_cast<float>(transform[0][0]), static_cast<float>(transform[0][1]), static_cast<float>(transform[0][2]) };
         data.ModelRow1 = { static_cast<float>(transform[1][0]), static_cast<float>(transform[1][1]), static_cast<float>(transform[1][2]) };
@@ -202,24 +211,57 @@ namespace CS200
 
         data.TintColor = CS200::unpack_color(tintColor);
         data.TexID     = GetTextureSlot(texture);
+        data.ShapeID   = static_cast<int>(Shape::Textured);
 
         m_InstanceData.push_back(data);
         m_InstanceCount++;
     }
 
-    void InstancedRenderer2D::DrawCircle(const Math::TransformationMatrix&, CS200::RGBA, CS200::RGBA, double)
+    void InstancedRenderer2D::DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width)
+    {
+        DrawSDF(transform, fill_color, line_color, line_width, Shape::Circle);
+    }
+
+    void InstancedRenderer2D::DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width)
     {
+        DrawSDF(transform, fill_color, line_color, line_width, Shape::Rectangle);
     }
 
-    void InstancedRenderer2D::DrawRectangle(const Math::TransformationMatrix&, CS200::RGBA, CS200::RGBA, double)
+    void InstancedRenderer2D::DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width)
     {
+        const auto line_transform = Renderer2DUtils::CalculateLineTransform(transform, start_point, end_point, line_width);
+        DrawSDF(line_transform, line_color, line_color, line_width, Shape::Rectangle);
     }
 
-    void InstancedRenderer2D::DrawLine(const Math::TransformationMatrix&, Math::vec2, Math::vec2, CS200::RGBA, double)
+    void InstancedRenderer2D::DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width)
     {
+        DrawLine(Math::TransformationMatrix{}, start_point, end_point, line_color, line_width);
     }
 
-    void InstancedRenderer2D::DrawLine(Math::vec2, Math::vec2, CS200::RGBA, double)
+    void InstancedRenderer2D::DrawSDF(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, Shape shape)
     {
+        ReserveInstance();
+
+        // QuadTransform is column-major: rows are (0, 3, 6) and (1, 4, 7)
+        const auto  sdf_transform = Renderer2DUtils::CalculateSDFTransform(transform, line_width);
+        const auto& q             = sdf_transform.QuadTransform;
+
+        InstanceData data{};
+
+        data.ModelRow0 = { q[0], q[3], q[6] };
+        data.ModelRow1 = { q[1], q[4], q[7] };
+
+        // Maps the unit quad texture coordinates (0..1) back to its local position (-0.5..0.5) for the SDF
+        data.TexCoordScale  = { 1.0f, 1.0f };
+        data.TexCoordOffset = { -0.5f, -0.5f };
+
+        data.TintColor = CS200::unpack_color(fill_color);
+        data.ShapeID   = static_cast<int>(shape);
+        data.LineColor = CS200::unpack_color(line_color);
+        data.SDFSize   = { sdf_transform.WorldSize[0], sdf_transform.WorldSize[1], sdf_transform.QuadSize[0], sdf_transform.QuadSize[1] };
+        data.LineWidth = static_cast<float>(line_width);
+
+        m_InstanceData.push_back(data);
+        m_InstanceCount++;
     }
-}
\ No newline at end of file
+}
@@ -13,15 +13,25 @@
 #include "OpenGL/VertexArray.hpp"
 #include "Renderer2DUtils.hpp"
 #include <array>
+#include <cstdint>
 #include <vector>
 
 namespace CS200
 {
+    /**
+     * \brief 2D renderer that draws every primitive as an instance of one shared unit quad
+     *
+     * Quads, circles, rectangles and lines each append one InstanceData record (model rows,
+     * colours, texture or SDF parameters and a shape id) to the instance buffer. A flush is
+     * a single glDrawElementsInstanced, and since all shapes share the buffer they keep their
+     * submission order. Batches are flushed when the buffer or texture slots fill up, on
+     * EndScene() and on Flush().
+     */
     class InstancedRenderer2D : public IRenderer2D
     {
     public:
         InstancedRenderer2D();
-        ~InstancedRenderer2D();
+        ~InstancedRenderer2D() override;
 
         InstancedRenderer2D(const InstancedRenderer2D&)                = delete;
         InstancedRenderer2D(InstancedRenderer2D&&) noexcept            = delete;
@@ -32,6 +42,7 @@ namespace CS200
 
         void BeginScene(const Math::TransformationMatrix& view_projection) override;
         void EndScene() override;
+        void Flush() override;
 
         void DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor) override;
 
@@ -40,11 +51,27 @@ namespace CS200
         void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width) override;
         void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width) override;
 
+        uint64_t GetDrawCallCount() const override
+        {
+            return m_drawCallCount;
+        }
+
     private:
-        void Flush();
+        // Kept in sync with the shape ids in Instanced.frag
+        enum class Shape : int
+        {
+            Textured  = 0,
+            Circle    = 1,
+            Rectangle = 2,
+        };
+
         void StartBatch();
+        void ReserveInstance();
         int  GetTextureSlot(OpenGL::TextureHandle texture);
+        void DrawSDF(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, Shape shape);
 
+        // TintColor is the fill colour for SDF shapes, whose texture coordinates are mapped back onto the
+        // unit quad. LineColor, SDFSize (world size xy, quad size zw) and LineWidth are only read for SDF shapes.
         struct InstanceData
         {
             std::array<float, 3> ModelRow0;
@@ -53,6 +80,10 @@ namespace CS200
             std::array<float, 2> TexCoordScale;
             std::array<float, 2> TexCoordOffset;
             int                  TexID;
+            int                  ShapeID;
+            std::array<float, 4> LineColor;
+            std::array<float, 4> SDFSize;
+            float                LineWidth;
         };
 
         OpenGL::VertexArrayHandle m_VAO         = 0;
@@ -60,15 +91,17 @@ namespace CS200
         OpenGL::BufferHandle      m_InstanceVBO = 0;
         OpenGL::BufferHandle      m_EBO         = 0;
         OpenGL::CompiledShader    m_Shader{};
+        OpenGL::UniformHandle     m_NDCMatrixUniform{};
 
         std::vector<InstanceData> m_InstanceData;
         uint32_t                  m_InstanceCount = 0;
 
         std::vector<OpenGL::TextureHandle> m_TextureSlots;
-        uint32_t                           m_TextureSlotIndex = 1;
+        uint32_t                           m_TextureSlotIndex = 0;
 
         static constexpr uint32_t MAX_INSTANCES_PER_BATCH = 10000;
 
         Math::TransformationMatrix m_ViewProjection{};
+        uint64_t                   m_drawCallCount = 0;
     };
 }
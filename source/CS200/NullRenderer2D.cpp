@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "NullRenderer2D.hpp"
+
+namespace CS200
+{
+    void NullRenderer2D::Init()
+    {
+        counters = {};
+    }
+
+    void NullRenderer2D::Shutdown()
+    {
+    }
+
+    void NullRenderer2D::BeginScene([[maybe_unused]] const Math::TransformationMatrix& view_projection)
+    {
+        ++counters.scenes;
+    }
+
+    void NullRenderer2D::EndScene()
+    {
+    }
+
+    void NullRenderer2D::DrawQuad(
+        [[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] OpenGL::TextureHandle texture, [[maybe_unused]] Math::vec2 texture_coord_bl,
+        [[maybe_unused]] Math::vec2 texture_coord_tr, [[maybe_unused]] CS200::RGBA tintColor)
+    {
+        ++counters.quads;
+    }
+
+    void NullRenderer2D::DrawCircle(
+        [[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] CS200::RGBA fill_color, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width)
+    {
+        ++counters.circles;
+    }
+
+    void NullRenderer2D::DrawRectangle(
+        [[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] CS200::RGBA fill_color, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width)
+    {
+        ++counters.rectangles;
+    }
+
+    void NullRenderer2D::DrawLine(
+        [[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] Math::vec2 startPoint, [[maybe_unused]] Math::vec2 endPoint, [[maybe_unused]] CS200::RGBA line_color,
+        [[maybe_unused]] double line_width)
+    {
+        ++counters.lines;
+    }
+
+    void NullRenderer2D::DrawLine([[maybe_unused]] Math::vec2 start_point, [[maybe_unused]] Math::vec2 end_point, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width)
+    {
+        ++counters.lines;
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+
+#include "IRenderer2D.hpp"
+#include <cstdint>
+
+namespace CS200
+{
+    /**
+     * \brief Renderer that touches no GPU state and only counts what it is asked to draw
+     *
+     * Used by the headless engine so game states can run their Draw code (or skip it)
+     * without a window or GL context. The counters give a cheap measure of how much
+     * work a frame would submit to a real renderer.
+     */
+    class NullRenderer2D : public IRenderer2D
+    {
+    public:
+        struct Counters
+        {
+            uint64_t scenes     = 0;
+            uint64_t quads      = 0;
+            uint64_t circles    = 0;
+            uint64_t rectangles = 0;
+            uint64_t lines      = 0;
+        };
+
+        void Init() override;
+        void Shutdown() override;
+
+        void BeginScene(const Math::TransformationMatrix& view_projection) override;
+        void EndScene() override;
+
+        void DrawQuad(
+            const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl = Math::vec2{ 0.0, 0.0 }, Math::vec2 texture_coord_tr = Math::vec2{ 1.0, 1.0 },
+            CS200::RGBA tintColor = CS200::WHITE) override;
+        void DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color = CS200::CLEAR, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0) override;
+        void DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color = CS200::CLEAR, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0) override;
+        void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 startPoint, Math::vec2 endPoint, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0) override;
+        void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0) override;
+
+        const Counters& GetCounters() const
+        {
+            return counters;
+        }
+
+        void ResetCounters()
+        {
+            counters = {};
+        }
+
+    private:
+        Counters counters;
+    };
+}
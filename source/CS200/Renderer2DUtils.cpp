@@ -7,6 +7,7 @@
  */
 #include "Renderer2DUtils.hpp"
 
+#include "Engine/Affine.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -16,16 +17,13 @@ namespace CS200::Renderer2DUtils
     {
         const Math::vec2 line_vector = end_point - start_point;
 
-        const double            angle             = std::atan2(line_vector.y, line_vector.x);
-        constexpr double        center_multiplier = 0.5;
-        const Math::vec2        center_point      = (start_point + end_point) * center_multiplier;
-        const Math::ScaleMatrix scale_matrix{
-            { line_vector.Length(), line_width }
-        };
-        const Math::RotationMatrix    rotation_matrix{ angle };
-        const Math::TranslationMatrix translation_matrix{ center_point };
-        const auto                    final_transform = transform * translation_matrix * rotation_matrix * scale_matrix;
-        return final_transform;
+        const double     angle             = std::atan2(line_vector.y, line_vector.x);
+        constexpr double center_multiplier = 0.5;
+        const Math::vec2 center_point      = (start_point + end_point) * center_multiplier;
+
+        // transform * T(center) * R(angle) * S(length, width), with the last three folded into one affine matrix
+        const auto line_matrix = Math::AffineMatrix::TRS(center_point, angle, { line_vector.Length(), line_width });
+        return transform * line_matrix;
     }
 
     SDFTransform CalculateSDFTransform(const Math::TransformationMatrix& transform, double line_width) noexcept
@@ -0,0 +1,107 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Matrix.hpp"
+#include "Vec2.hpp"
+#include <cmath>
+
+namespace Math
+{
+    // 2D affine transform: the top two rows of a TransformationMatrix, whose third row is always 0 0 1.
+    // Composing two of these is 12 multiplies instead of 27 and a point transform skips the homogeneous row.
+    // Convert with ToMatrix() where an API still takes a TransformationMatrix.
+    struct AffineMatrix
+    {
+        double m00 = 1.0;
+        double m01 = 0.0;
+        double m02 = 0.0;
+        double m10 = 0.0;
+        double m11 = 1.0;
+        double m12 = 0.0;
+
+        constexpr AffineMatrix() = default;
+
+        constexpr AffineMatrix(double a00, double a01, double a02, double a10, double a11, double a12) : m00(a00), m01(a01), m02(a02), m10(a10), m11(a11), m12(a12)
+        {
+        }
+
+        // Drops the third row, so only exact for matrices built from translations, rotations and scales
+        constexpr explicit AffineMatrix(const TransformationMatrix& m) : m00(m[0][0]), m01(m[0][1]), m02(m[0][2]), m10(m[1][0]), m11(m[1][1]), m12(m[1][2])
+        {
+        }
+
+        [[nodiscard]] static constexpr AffineMatrix Translation(vec2 translate)
+        {
+            return { 1.0, 0.0, translate.x, 0.0, 1.0, translate.y };
+        }
+
+        [[nodiscard]] static constexpr AffineMatrix Scale(vec2 scale)
+        {
+            return { scale.x, 0.0, 0.0, 0.0, scale.y, 0.0 };
+        }
+
+        [[nodiscard]] static AffineMatrix Rotation(double theta)
+        {
+            const double c = std::cos(theta);
+            const double s = std::sin(theta);
+            return { c, -s, 0.0, s, c, 0.0 };
+        }
+
+        // Translation(translate) * Rotation(theta) * Scale(scale) without the two intermediate products
+        [[nodiscard]] static AffineMatrix TRS(vec2 translate, double theta, vec2 scale)
+        {
+            const double c = std::cos(theta);
+            const double s = std::sin(theta);
+            return { c * scale.x, -s * scale.y, translate.x, s * scale.x, c * scale.y, translate.y };
+        }
+
+        [[nodiscard]] constexpr AffineMatrix operator*(const AffineMatrix& m) const
+        {
+            return { m00 * m.m00 + m01 * m.m10, m00 * m.m01 + m01 * m.m11, m00 * m.m02 + m01 * m.m12 + m02,
+                     m10 * m.m00 + m11 * m.m10, m10 * m.m01 + m11 * m.m11, m10 * m.m02 + m11 * m.m12 + m12 };
+        }
+
+        constexpr AffineMatrix& operator*=(const AffineMatrix& m)
+        {
+            (*this) = (*this) * m;
+            return (*this);
+        }
+
+        // Transforms a point (translation applied)
+        [[nodiscard]] constexpr vec2 operator*(vec2 v) const
+        {
+            return { m00 * v.x + m01 * v.y + m02, m10 * v.x + m11 * v.y + m12 };
+        }
+
+        [[nodiscard]] constexpr TransformationMatrix ToMatrix() const
+        {
+            TransformationMatrix result;
+            result[0][0] = m00;
+            result[0][1] = m01;
+            result[0][2] = m02;
+            result[1][0] = m10;
+            result[1][1] = m11;
+            result[1][2] = m12;
+            return result;
+        }
+    };
+
+    // A general matrix times an affine one, for the camera * object products in the draw path
+    [[nodiscard]] constexpr TransformationMatrix operator*(const TransformationMatrix& a, const AffineMatrix& b)
+    {
+        TransformationMatrix result;
+        for (int row = 0; row < 3; ++row)
+        {
+            result[row][0] = a[row][0] * b.m00 + a[row][1] * b.m10;
+            result[row][1] = a[row][0] * b.m01 + a[row][1] * b.m11;
+            result[row][2] = a[row][0] * b.m02 + a[row][1] * b.m12 + a[row][2];
+        }
+        return result;
+    }
+}
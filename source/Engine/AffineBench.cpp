@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "AffineBench.hpp"
+#include "Affine.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+int Math::BenchmarkAffine()
+{
+    constexpr int                    count  = 1 << 16;
+    constexpr int                    runs   = 32;
+    const Math::TransformationMatrix camera = Math::ScaleMatrix({ 2.0 / 1280.0, 2.0 / 720.0 }) * Math::TranslationMatrix(Math::vec2{ -640.0, -360.0 });
+    const Math::AffineMatrix         camera_affine{ camera };
+    constexpr Math::vec2             corners[] = { { -0.5, -0.5 }, { 0.5, -0.5 }, { 0.5, 0.5 }, { -0.5, 0.5 } };
+
+    std::vector<Math::vec2> positions(count);
+    std::vector<double>     rotations(count);
+    for (int i = 0; i < count; ++i)
+    {
+        positions[static_cast<size_t>(i)] = { static_cast<double>(i % 256) * 5.0, static_cast<double>(i / 256) * 3.0 };
+        rotations[static_cast<size_t>(i)] = static_cast<double>(i) * 0.001;
+    }
+
+    double     matrix_sum   = 0.0;
+    const auto matrix_start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; ++run)
+    {
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const Math::TransformationMatrix model = camera * (Math::TranslationMatrix(positions[i]) * Math::RotationMatrix(rotations[i]) * Math::ScaleMatrix({ 32.0, 16.0 }));
+            for (const Math::vec2 corner : corners)
+            {
+                const Math::vec2 p = model * corner;
+                matrix_sum += p.x + p.y;
+            }
+        }
+    }
+    const double matrix_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - matrix_start).count();
+
+    double     affine_sum   = 0.0;
+    const auto affine_start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; ++run)
+    {
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const Math::AffineMatrix model = camera_affine * Math::AffineMatrix::TRS(positions[i], rotations[i], { 32.0, 16.0 });
+            for (const Math::vec2 corner : corners)
+            {
+                const Math::vec2 p = model * corner;
+                affine_sum += p.x + p.y;
+            }
+        }
+    }
+    const double affine_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - affine_start).count();
+
+    const double transforms = static_cast<double>(count) * runs;
+    std::cout << "bench-math: " << count * runs << " transforms, 4 corners each\n"
+              << "  3x3 chain: " << matrix_seconds * 1e9 / transforms << " ns/transform (checksum " << matrix_sum << ")\n"
+              << "  affine:    " << affine_seconds * 1e9 / transforms << " ns/transform (checksum " << affine_sum << ")\n"
+              << "  speedup:   " << (affine_seconds > 0.0 ? matrix_seconds / affine_seconds : 0.0) << "x\n";
+    return 0;
+}
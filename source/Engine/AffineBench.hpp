@@ -0,0 +1,17 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+
+namespace Math
+{
+    // --bench-math: builds object transforms the way GameObject and the line renderer do and pushes the four quad
+    // corners through camera * object, once with chained 3x3 TransformationMatrix products and once with AffineMatrix.
+    // Returns the process exit code.
+    int BenchmarkAffine();
+}
@@ -19,10 +19,16 @@ void AudioManager::Initialize()
     // Safe default volumes — LoadSettings will override these if a config exists
     Mix_VolumeMusic(7);  // BGM: 7/128
     Mix_Volume(-1, 4);   // SFX: 4/128
+
+    isOpen = true;
 }
 
 void AudioManager::Shutdown()
 {
+    if (!isOpen)
+        return;
+    isOpen = false;
+
     // Free all loaded audio resources
     for (auto& pair : audioMap)
     {
@@ -36,7 +42,7 @@ void AudioManager::Shutdown()
 void AudioManager::LoadSound(const std::string& name, const std::filesystem::path& filePath, AudioTypes audioType)
 {
     // Prevent loading the same sound multiple times
-    if (audioMap.find(name) != audioMap.end())
+    if (!isOpen || audioMap.find(name) != audioMap.end())
         return;
 
     Audio* newAudio = new Audio(filePath, audioType);
@@ -45,6 +51,9 @@ void AudioManager::LoadSound(const std::string& name, const std::filesystem::pat
 
 void AudioManager::Play(const std::string& name)
 {
+    if (!isOpen)
+        return;
+
     auto it = audioMap.find(name);
     if (it == audioMap.end())
     {
@@ -68,17 +77,23 @@ void AudioManager::Play(const std::string& name)
 
 void AudioManager::StopBGM()
 {
+    if (!isOpen)
+        return;
     Mix_HaltMusic();
 }
 
 void AudioManager::SetBGMVolume(int volume)
 {
+    if (!isOpen)
+        return;
     // Volume ranges from 0 to MIX_MAX_VOLUME (normally 128)
     Mix_VolumeMusic(volume); // Set volume for BGM
 }
 
 void AudioManager::SetSFXVolume(int volume)
 {
+    if (!isOpen)
+        return;
     // Volume ranges from 0 to MIX_MAX_VOLUME (normally 128)
     Mix_Volume(-1, volume);  // Set volume for all SFX channels
 }
\ No newline at end of file
@@ -22,4 +22,6 @@ public:
 
 private:
     inline static std::unordered_map<std::string, Audio*> audioMap;
+    // False until Initialize runs (never in headless mode); every call is then a no-op
+    inline static bool isOpen = false;
 };
\ No newline at end of file
@@ -9,13 +9,20 @@
 #include "Camera.hpp"
 #include "Engine/Engine.hpp"
 
-CS230::Camera::Camera(Math::rect pz) : player_zone(pz), position({ 0, 0 })
+CS230::Camera::Camera(Math::rect pz) : player_zone(pz), position({ 0, 0 }), previous_position({ 0, 0 })
 {
 }
 
 void CS230::Camera::SetPosition(Math::vec2 new_position)
 {
-    position = new_position;
+    position          = new_position;
+    previous_position = new_position;
+}
+
+void CS230::Camera::MoveTo(Math::vec2 new_position)
+{
+    previous_position = position;
+    position          = new_position;
 }
 
 const Math::vec2& CS230::Camera::GetPosition() const
@@ -23,6 +30,12 @@ const Math::vec2& CS230::Camera::GetPosition() const
     return position;
 }
 
+Math::vec2 CS230::Camera::GetRenderPosition() const
+{
+    const double alpha = Engine::GetWindowEnvironment().InterpolationAlpha;
+    return alpha >= 1.0 ? position : previous_position + (position - previous_position) * alpha;
+}
+
 void CS230::Camera::SetLimit(Math::irect new_limit)
 {
     limit = new_limit;
@@ -59,6 +72,8 @@ void CS230::Camera::SetLimit(Math::irect new_limit)
 // }
 void CS230::Camera::Update(const Math::vec2& target_position, double dt)
 {
+    previous_position = position;
+
     if (smoothing <= 0.0f)
     {
         position = target_position;
@@ -89,5 +104,5 @@ void CS230::Camera::Update(const Math::vec2& target_position, double dt)
 
 Math::TransformationMatrix CS230::Camera::GetMatrix()
 {
-    return Math::ScaleMatrix(scale) * Math::TranslationMatrix(-position);
+    return Math::ScaleMatrix(scale) * Math::TranslationMatrix(-GetRenderPosition());
 }
\ No newline at end of file
@@ -20,8 +20,13 @@ namespace CS230
         using CS230::Component::Update;
 
         Camera(Math::rect pz);
+        // Hard snap: also resets the interpolation start so the jump is not drawn blended
         void              SetPosition(Math::vec2 new_position);
+        // One simulation tick's move: keeps the previous position so drawing interpolates the step
+        void              MoveTo(Math::vec2 new_position);
         const Math::vec2& GetPosition() const;
+        // Position blended between the last two ticks (see WindowEnvironment::InterpolationAlpha)
+        Math::vec2        GetRenderPosition() const;
         void              SetLimit(Math::irect new_limit);
         void              Update(const Math::vec2& target_position, double dt);
 
@@ -35,6 +40,7 @@ namespace CS230
             return scale;
         }
 
+        // View matrix at the interpolated position between the last two updates (see WindowEnvironment::InterpolationAlpha)
         Math::TransformationMatrix GetMatrix();
 
         void SetSmoothing(float new_smoothing)
@@ -46,6 +52,7 @@ namespace CS230
         Math::irect limit;
         Math::rect  player_zone;
         Math::vec2  position;
+        Math::vec2  previous_position;
         float       smoothing = 0.0f;
         double      scale     = 1.0;
     };
@@ -5,86 +5,344 @@
 #include "Engine/GameObject.hpp"
 #include "Engine/Logger.hpp"
 #include "Engine/Polygon.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
 
-void ProjectPolygon(const Polygon& polygon, const Math::vec2& axis, double& min, double& max)
+namespace
 {
-    if (polygon.vertices.empty())
+    void ProjectVertices(std::span<const Math::vec2> vertices, Math::vec2 axis, double& min, double& max)
     {
-        min = 0;
-        max = 0;
-        return;
+        double project_result = dot(vertices[0], axis);
+        min                   = project_result;
+        max                   = project_result;
+
+        for (size_t i = 1; i < vertices.size(); i++)
+        {
+            project_result = dot(vertices[i], axis);
+            if (project_result < min)
+                min = project_result;
+            if (project_result > max)
+                max = project_result;
+        }
     }
 
-    double project_result = dot(polygon.vertices[0], axis);
-    min                   = project_result;
-    max                   = project_result;
+    // Keeps the axis with the least overlap, pointed from the first interval toward the second.
+    // False when the intervals are apart; touching intervals overlap by zero.
+    bool AccumulateOverlap(Math::vec2 axis, double minA, double maxA, double minB, double maxB, CS230::Contact& best)
+    {
+        if (maxA < minB || maxB < minA)
+            return false;
 
-    for (size_t i = 1; i < polygon.vertices.size(); i++)
+        const double push_forward  = maxA - minB;
+        const double push_backward = maxB - minA;
+        const double depth         = std::min(push_forward, push_backward);
+        if (depth < best.depth)
+        {
+            best.depth  = depth;
+            best.normal = push_forward <= push_backward ? axis : axis * -1.0;
+        }
+        return true;
+    }
+
+    // Axes must be unit length (degenerate ones are skipped); both vertex sets must be non-empty
+    bool OverlapOnAxes(std::span<const Math::vec2> axes, std::span<const Math::vec2> vertices_1, std::span<const Math::vec2> vertices_2, CS230::Contact& best)
     {
-        project_result = dot(polygon.vertices[i], axis);
-        if (project_result < min)
-            min = project_result;
-        if (project_result > max)
-            max = project_result;
+        for (const Math::vec2& axis : axes)
+        {
+            if (!(axis.LengthSquared() > 0.5))
+                continue;
+
+            double minA, maxA, minB, maxB;
+            ProjectVertices(vertices_1, axis, minA, maxA);
+            ProjectVertices(vertices_2, axis, minB, maxB);
+
+            if (!AccumulateOverlap(axis, minA, maxA, minB, maxB, best))
+                return false;
+        }
+        return true;
     }
-}
 
-namespace CS230
-{
-    RectCollision::RectCollision(Math::irect bound, GameObject* obj) : boundary(bound), object(obj)
+    // Same, with the second shape a circle, which projects to center +- radius on every axis
+    bool OverlapOnAxes(std::span<const Math::vec2> axes, std::span<const Math::vec2> vertices, Math::vec2 center, double radius, CS230::Contact& best)
+    {
+        for (const Math::vec2& axis : axes)
+        {
+            if (!(axis.LengthSquared() > 0.5))
+                continue;
+
+            double minA, maxA;
+            ProjectVertices(vertices, axis, minA, maxA);
+            const double projection = dot(center, axis);
+
+            if (!AccumulateOverlap(axis, minA, maxA, projection - radius, projection + radius, best))
+                return false;
+        }
+        return true;
+    }
+
+    CS230::Contact NoContactYet()
     {
+        return { { 0.0, 0.0 }, std::numeric_limits<double>::max() };
     }
 
-    Math::rect RectCollision::WorldBoundary()
+    std::array<Math::vec2, 4> Corners(const Math::rect& rect)
     {
-        return { object->GetMatrix() * static_cast<Math::vec2>(boundary.point_1), object->GetMatrix() * static_cast<Math::vec2>(boundary.point_2) };
+        return {
+            Math::vec2{  rect.Left(), rect.Bottom() },
+            Math::vec2{ rect.Right(), rect.Bottom() },
+            Math::vec2{ rect.Right(),    rect.Top() },
+            Math::vec2{  rect.Left(),    rect.Top() }
+        };
     }
 
-    void RectCollision::Draw(const Math::TransformationMatrix& display_matrix)
+    // An axis-aligned rect only contributes the two world axes
+    constexpr std::array<Math::vec2, 2> rect_axes = {
+        Math::vec2{ 1.0, 0.0 },
+        Math::vec2{ 0.0, 1.0 }
+    };
+
+    // Narrowphase table entries. Each casts to the concrete types its table slot guarantees.
+
+    bool RectVsRect(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
     {
-        auto&      renderer       = Engine::GetRenderer2D();
-        Math::rect world_boundary = WorldBoundary();
+        const Math::rect rectangle_1 = static_cast<CS230::RectCollision&>(a).WorldBoundary();
+        const Math::rect rectangle_2 = static_cast<CS230::RectCollision&>(b).WorldBoundary();
 
-        Math::vec2 bottom_left  = display_matrix * Math::vec2{ world_boundary.Left(), world_boundary.Bottom() };
-        Math::vec2 bottom_right = display_matrix * Math::vec2{ world_boundary.Right(), world_boundary.Bottom() };
-        Math::vec2 top_left     = display_matrix * Math::vec2{ world_boundary.Left(), world_boundary.Top() };
-        Math::vec2 top_right    = display_matrix * Math::vec2{ world_boundary.Right(), world_boundary.Top() };
+        // Strict: rects that only share an edge do not collide
+        if (!(rectangle_1.Right() > rectangle_2.Left() && rectangle_1.Left() < rectangle_2.Right() && rectangle_1.Top() > rectangle_2.Bottom() && rectangle_1.Bottom() < rectangle_2.Top()))
+            return false;
 
-        renderer.DrawLine(top_left, top_right, CS200::WHITE, 1.0);
-        renderer.DrawLine(top_right, bottom_right, CS200::WHITE, 1.0);
-        renderer.DrawLine(bottom_right, bottom_left, CS200::WHITE, 1.0);
-        renderer.DrawLine(bottom_left, top_left, CS200::WHITE, 1.0);
+        contact = NoContactYet();
+        AccumulateOverlap(rect_axes[0], rectangle_1.Left(), rectangle_1.Right(), rectangle_2.Left(), rectangle_2.Right(), contact);
+        AccumulateOverlap(rect_axes[1], rectangle_1.Bottom(), rectangle_1.Top(), rectangle_2.Bottom(), rectangle_2.Top(), contact);
+        return true;
     }
 
-    bool RectCollision::IsCollidingWith(GameObject* other_object)
+    bool RectVsCircle(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
     {
-        Collision* other_collider = other_object->GetGOComponent<Collision>();
+        const Math::rect rect   = static_cast<CS230::RectCollision&>(a).WorldBoundary();
+        auto&            circle = static_cast<CS230::CircleCollision&>(b);
+        const Math::vec2 center = circle.WorldCenter();
+        const double     radius = circle.GetRadius();
+
+        const Math::vec2 closest{ std::clamp(center.x, rect.Left(), rect.Right()), std::clamp(center.y, rect.Bottom(), rect.Top()) };
+        const Math::vec2 offset      = center - closest;
+        const double     distance_sq = offset.LengthSquared();
 
-        if (other_collider == nullptr)
+        if (distance_sq > radius * radius)
+            return false;
+
+        if (distance_sq > 0.0)
         {
-            // Engine::GetLogger().LogDebug("No collision component found in other object");
+            const double distance = std::sqrt(distance_sq);
+            contact               = { offset * (1.0 / distance), radius - distance };
+            return true;
+        }
+
+        // Center inside the rect: push out through the nearest face
+        const double to_left   = center.x - rect.Left();
+        const double to_right  = rect.Right() - center.x;
+        const double to_bottom = center.y - rect.Bottom();
+        const double to_top    = rect.Top() - center.y;
+
+        contact = { { -1.0, 0.0 }, to_left };
+        if (to_right < contact.depth)
+            contact = { { 1.0, 0.0 }, to_right };
+        if (to_bottom < contact.depth)
+            contact = { { 0.0, -1.0 }, to_bottom };
+        if (to_top < contact.depth)
+            contact = { { 0.0, 1.0 }, to_top };
+        contact.depth += radius;
+        return true;
+    }
+
+    bool RectVsPoly(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
+    {
+        const std::array<Math::vec2, 4> corners = Corners(static_cast<CS230::RectCollision&>(a).WorldBoundary());
+
+        auto&          poly  = static_cast<CS230::SATCollision&>(b);
+        const Polygon& world = poly.WorldBoundary();
+        if (world.vertexCount == 0)
+            return false;
+
+        contact = NoContactYet();
+        return OverlapOnAxes(rect_axes, corners, world.vertices, contact) && OverlapOnAxes(poly.WorldEdgeNormals(), corners, world.vertices, contact);
+    }
+
+    bool CircleVsCircle(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
+    {
+        auto&            circle_1   = static_cast<CS230::CircleCollision&>(a);
+        auto&            circle_2   = static_cast<CS230::CircleCollision&>(b);
+        const Math::vec2 offset     = circle_2.WorldCenter() - circle_1.WorldCenter();
+        const double     sum_radius = circle_1.GetRadius() + circle_2.GetRadius();
+
+        const double distance_sq = offset.LengthSquared();
+        if (distance_sq > sum_radius * sum_radius)
+            return false;
+
+        const double distance = std::sqrt(distance_sq);
+        contact.normal        = distance > 0.0 ? offset * (1.0 / distance) : Math::vec2{ 0.0, 1.0 };
+        contact.depth         = sum_radius - distance;
+        return true;
+    }
+
+    bool CircleVsPoly(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
+    {
+        auto&            circle = static_cast<CS230::CircleCollision&>(a);
+        const Math::vec2 center = circle.WorldCenter();
+        const double     radius = circle.GetRadius();
+
+        auto&          poly  = static_cast<CS230::SATCollision&>(b);
+        const Polygon& world = poly.WorldBoundary();
+        if (world.vertexCount == 0)
             return false;
+
+        // Besides the edge normals, the axis toward the nearest vertex separates a circle sitting off a corner
+        Math::vec2 nearest             = world.vertices[0];
+        double     nearest_distance_sq = (center - nearest).LengthSquared();
+        for (const Math::vec2& vertex : world.vertices)
+        {
+            const double distance_sq = (center - vertex).LengthSquared();
+            if (distance_sq < nearest_distance_sq)
+            {
+                nearest             = vertex;
+                nearest_distance_sq = distance_sq;
+            }
         }
 
-        Math::rect rectangle_1 = WorldBoundary();
+        const std::array<Math::vec2, 1> corner_axis = { nearest_distance_sq > 0.0 ? (nearest - center) * (1.0 / std::sqrt(nearest_distance_sq)) : Math::vec2{ 0.0, 0.0 } };
 
-        if (other_collider->Shape() == CollisionShape::Rect)
+        // Project with the polygon first, then flip so the normal points from the circle toward the polygon
+        contact = NoContactYet();
+        if (!OverlapOnAxes(poly.WorldEdgeNormals(), world.vertices, center, radius, contact) || !OverlapOnAxes(corner_axis, world.vertices, center, radius, contact))
+            return false;
+
+        contact.normal = contact.normal * -1.0;
+        return true;
+    }
+
+    bool PolyVsPoly(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
+    {
+        auto& poly_1 = static_cast<CS230::SATCollision&>(a);
+        auto& poly_2 = static_cast<CS230::SATCollision&>(b);
+
+        const Polygon& world_1 = poly_1.WorldBoundary();
+        const Polygon& world_2 = poly_2.WorldBoundary();
+        if (world_1.vertexCount == 0 || world_2.vertexCount == 0)
+            return false;
+
+        // Cheap reject before any projection
+        const Math::rect box_1 = poly_1.WorldBoundingBox();
+        const Math::rect box_2 = poly_2.WorldBoundingBox();
+        if (box_1.Right() < box_2.Left() || box_2.Right() < box_1.Left() || box_1.Top() < box_2.Bottom() || box_2.Top() < box_1.Bottom())
+            return false;
+
+        contact = NoContactYet();
+        return OverlapOnAxes(poly_1.WorldEdgeNormals(), world_1.vertices, world_2.vertices, contact) && OverlapOnAxes(poly_2.WorldEdgeNormals(), world_1.vertices, world_2.vertices, contact);
+    }
+
+    // Lower-triangle entries run the mirrored test and flip the normal back
+    template <bool (*Test)(CS230::Collision&, CS230::Collision&, CS230::Contact&)>
+    bool Swapped(CS230::Collision& a, CS230::Collision& b, CS230::Contact& contact)
+    {
+        if (!Test(b, a, contact))
+            return false;
+
+        contact.normal = contact.normal * -1.0;
+        return true;
+    }
+
+    using NarrowphaseTest = bool (*)(CS230::Collision&, CS230::Collision&, CS230::Contact&);
+
+    constexpr size_t shape_count = 3;
+
+    // Indexed [first shape][second shape] in CollisionShape order: Rect, Circle, Poly
+    constexpr std::array<std::array<NarrowphaseTest, shape_count>, shape_count> narrowphase_table{ {
+        { RectVsRect, RectVsCircle, RectVsPoly },
+        { Swapped<RectVsCircle>, CircleVsCircle, CircleVsPoly },
+        { Swapped<RectVsPoly>, Swapped<CircleVsPoly>, PolyVsPoly },
+    } };
+}
+
+namespace CS230
+{
+    bool Collision::TransformChanged(const GameObject* owner)
+    {
+        const uint32_t version = owner->GetTransformVersion();
+        if (has_cached_transform && cached_transform_version == version)
         {
-            Math::rect rectangle_2 = static_cast<RectCollision*>(other_collider)->WorldBoundary();
-            return (rectangle_1.Right() > rectangle_2.Left() && rectangle_1.Left() < rectangle_2.Right() && rectangle_1.Top() > rectangle_2.Bottom() && rectangle_1.Bottom() < rectangle_2.Top());
+            return false;
         }
-        else if (other_collider->Shape() == CollisionShape::Poly)
+
+        cached_transform_version = version;
+        has_cached_transform     = true;
+        return true;
+    }
+
+    bool Collision::IsCollidingWith(GameObject* other_object, Contact* contact)
+    {
+        Collision* other_collider = other_object->GetGOComponent<Collision>();
+        return other_collider != nullptr && Collide(*this, *other_collider, contact);
+    }
+
+    bool Collide(Collision& a, Collision& b, Contact* contact)
+    {
+        const size_t first  = static_cast<size_t>(a.Shape());
+        const size_t second = static_cast<size_t>(b.Shape());
+        if (first >= shape_count || second >= shape_count)
         {
-            return other_collider->IsCollidingWith(this->object);
+            Engine::GetLogger().LogError("Collide: unsupported collision shape");
+            return false;
         }
-        else if (other_collider->Shape() == CollisionShape::Circle)
+
+        Contact result;
+        if (!narrowphase_table[first][second](a, b, result))
         {
-            // Engine::GetLogger().LogDebug("Rect vs Circle collision not yet implemented.");
             return false;
         }
 
-        Engine::GetLogger().LogError("Rect vs unsupported type");
-        return false;
+        if (contact != nullptr)
+        {
+            *contact = result;
+        }
+        return true;
+    }
+
+    RectCollision::RectCollision(Math::irect bound, GameObject* obj) : boundary(bound), object(obj)
+    {
+    }
+
+    Math::rect RectCollision::WorldBoundary()
+    {
+        if (TransformChanged(object))
+        {
+            world_rect = { object->GetMatrix() * static_cast<Math::vec2>(boundary.point_1), object->GetMatrix() * static_cast<Math::vec2>(boundary.point_2) };
+        }
+        return world_rect;
+    }
+
+    Math::rect RectCollision::WorldBoundingBox()
+    {
+        return WorldBoundary();
+    }
+
+    void RectCollision::Draw(const Math::TransformationMatrix& display_matrix)
+    {
+        auto&      renderer       = Engine::GetRenderer2D();
+        Math::rect world_boundary = WorldBoundary();
+
+        Math::vec2 bottom_left  = display_matrix * Math::vec2{ world_boundary.Left(), world_boundary.Bottom() };
+        Math::vec2 bottom_right = display_matrix * Math::vec2{ world_boundary.Right(), world_boundary.Bottom() };
+        Math::vec2 top_left     = display_matrix * Math::vec2{ world_boundary.Left(), world_boundary.Top() };
+        Math::vec2 top_right    = display_matrix * Math::vec2{ world_boundary.Right(), world_boundary.Top() };
+
+        renderer.DrawLine(top_left, top_right, CS200::WHITE, 1.0);
+        renderer.DrawLine(top_right, bottom_right, CS200::WHITE, 1.0);
+        renderer.DrawLine(bottom_right, bottom_left, CS200::WHITE, 1.0);
+        renderer.DrawLine(bottom_left, top_left, CS200::WHITE, 1.0);
     }
 
     bool RectCollision::IsCollidingWith(Math::vec2 point)
@@ -112,31 +370,16 @@ namespace CS230
         return scale.x > scale.y ? radius * scale.x : radius * scale.y;
     }
 
-    bool CircleCollision::IsCollidingWith(GameObject* other_object)
+    Math::vec2 CircleCollision::WorldCenter() const
     {
-        Collision* other_collider = other_object->GetGOComponent<Collision>();
-        if (other_collider == nullptr)
-        {
-            // Engine::GetLogger().LogDebug("No collision component found in other object");
-            return false;
-        }
+        return object->GetPosition();
+    }
 
-        if (other_collider->Shape() == CollisionShape::Circle)
-        {
-            CircleCollision* other       = dynamic_cast<CircleCollision*>(other_collider);
-            Math::vec2       A           = object->GetPosition();
-            Math::vec2       B           = other->object->GetPosition();
-            double           dx          = A.x - B.x;
-            double           dy          = A.y - B.y;
-            double           distance_sq = dx * dx + dy * dy;
-            double           sum_radius  = GetRadius() + other->GetRadius();
-            return distance_sq <= sum_radius * sum_radius;
-        }
-        else
-        {
-            // Engine::GetLogger().LogDebug("Circle vs (Rect/Poly) collision not yet implemented.");
-            return false;
-        }
+    Math::rect CircleCollision::WorldBoundingBox()
+    {
+        const Math::vec2 center = object->GetPosition();
+        const double     r      = GetRadius();
+        return { { center.x - r, center.y - r }, { center.x + r, center.y + r } };
     }
 
     bool CircleCollision::IsCollidingWith(Math::vec2 point)
@@ -155,119 +398,97 @@ namespace CS230
 
     void SATCollision::Draw(const Math::TransformationMatrix& display_matrix)
     {
-        auto&   renderer       = Engine::GetRenderer2D();
-        Polygon world_boundary = WorldBoundary();
+        auto&          renderer = Engine::GetRenderer2D();
+        const Polygon& world    = WorldBoundary();
 
-        if (world_boundary.vertexCount < 2)
+        if (world.vertexCount < 2)
             return;
 
-        for (size_t i = 0; i < static_cast<size_t>(world_boundary.vertexCount); ++i)
+        for (size_t i = 0; i < static_cast<size_t>(world.vertexCount); ++i)
         {
-            Math::vec2 p1 = world_boundary.vertices[i];
-            Math::vec2 p2 = world_boundary.vertices[(i + 1) % static_cast<size_t>(world_boundary.vertexCount)];
+            Math::vec2 p1 = world.vertices[i];
+            Math::vec2 p2 = world.vertices[(i + 1) % static_cast<size_t>(world.vertexCount)];
 
             renderer.DrawLine(display_matrix * p1, display_matrix * p2, CS200::WHITE, 1.0);
         }
     }
 
-    Polygon SATCollision::WorldBoundary()
+    void SATCollision::UpdateWorldGeometry()
     {
-        Polygon world_poly;
-        world_poly.vertexCount = boundary.vertexCount;
-        world_poly.vertices.reserve(static_cast<size_t>(boundary.vertexCount));
+        if (!TransformChanged(object))
+        {
+            return;
+        }
 
         const Math::TransformationMatrix& matrix = object->GetMatrix();
 
-        for (const auto& v : boundary.vertices)
+        world_boundary.vertexCount = boundary.vertexCount;
+        world_boundary.vertices.resize(boundary.vertices.size());
+        for (size_t i = 0; i < boundary.vertices.size(); ++i)
         {
-            world_poly.vertices.push_back(matrix * v);
+            world_boundary.vertices[i] = matrix * boundary.vertices[i];
         }
-        return world_poly;
-    }
 
-    bool SATCollision::IsCollidingWith(Math::vec2 point)
-    {
-        Polygon poly_1 = WorldBoundary();
-        if (poly_1.vertexCount == 0)
-            return false;
+        world_bounding_box = world_boundary.FindBoundary();
 
-        for (size_t i = 0; i < static_cast<size_t>(poly_1.vertexCount); ++i)
+        const size_t count = static_cast<size_t>(world_boundary.vertexCount);
+        world_normals.resize(count);
+        for (size_t i = 0; i < count; ++i)
         {
-            Math::vec2 edge = poly_1.vertices[(i + 1) % static_cast<size_t>(poly_1.vertexCount)] - poly_1.vertices[i];
-            Math::vec2 axis = GetPerpendicular(edge).Normalize();
-
-            double minA, maxA;
-            ProjectPolygon(poly_1, axis, minA, maxA);
-            double projection = dot(point, axis);
-
-            if (projection < minA || projection > maxA)
-            {
-                return false;
-            }
+            Math::vec2 edge  = world_boundary.vertices[(i + 1) % count] - world_boundary.vertices[i];
+            world_normals[i] = GetPerpendicular(edge).Normalize();
         }
-        return true;
+
+        world_edges_dirty = true;
     }
 
-    bool SATCollision::IsCollidingWith(GameObject* other_object)
+    const Polygon& SATCollision::WorldBoundary()
     {
-        Collision* other_collider = other_object->GetGOComponent<Collision>();
-        if (other_collider == nullptr)
-            return false;
+        UpdateWorldGeometry();
+        return world_boundary;
+    }
 
-        Polygon poly_1 = WorldBoundary();
-        Polygon poly_2;
+    const std::vector<Math::vec2>& SATCollision::WorldEdgeNormals()
+    {
+        UpdateWorldGeometry();
+        return world_normals;
+    }
 
-        if (other_collider->Shape() == CollisionShape::Poly)
-        {
-            poly_2 = static_cast<SATCollision*>(other_collider)->WorldBoundary();
-        }
-        else if (other_collider->Shape() == CollisionShape::Rect)
-        {
-            Math::rect rect = static_cast<RectCollision*>(other_collider)->WorldBoundary();
-            poly_2.vertices = {
-                {  rect.Left(), rect.Bottom() },
-                { rect.Right(), rect.Bottom() },
-                { rect.Right(),    rect.Top() },
-                {  rect.Left(),    rect.Top() }
-            };
-            poly_2.vertexCount = 4;
-        }
-        else if (other_collider->Shape() == CollisionShape::Circle)
+    const PolygonEdges& SATCollision::WorldEdges()
+    {
+        UpdateWorldGeometry();
+        if (world_edges_dirty)
         {
-            // Engine::GetLogger().LogDebug("SATCollision vs Circle-Collision.");
-            return false;
+            world_edges.Build(world_boundary);
+            world_edges_dirty = false;
         }
+        return world_edges;
+    }
 
-        if (poly_1.vertexCount == 0 || poly_2.vertexCount == 0)
-            return false;
-
-        for (size_t i = 0; i < static_cast<size_t>(poly_1.vertexCount); i++)
-        {
-            Math::vec2 edge = poly_1.vertices[(i + 1) % static_cast<size_t>(poly_1.vertexCount)] - poly_1.vertices[i];
-            Math::vec2 axis = GetPerpendicular(edge).Normalize();
-
-            double minA, maxA, minB, maxB;
-            ProjectPolygon(poly_1, axis, minA, maxA);
-            ProjectPolygon(poly_2, axis, minB, maxB);
+    Math::rect SATCollision::WorldBoundingBox()
+    {
+        UpdateWorldGeometry();
+        return world_bounding_box;
+    }
 
-            if (maxA < minB || maxB < minA)
-                return false;
-        }
+    bool SATCollision::IsCollidingWith(Math::vec2 point)
+    {
+        UpdateWorldGeometry();
+        if (world_boundary.vertexCount == 0)
+            return false;
 
-        for (size_t i = 0; i < static_cast<size_t>(poly_2.vertexCount); ++i)
+        for (const Math::vec2& axis : world_normals)
         {
-            Math::vec2 edge = poly_2.vertices[(i + 1) % static_cast<size_t>(poly_2.vertexCount)] - poly_2.vertices[i];
-            Math::vec2 axis = GetPerpendicular(edge).Normalize();
-
-            double minA, maxA, minB, maxB;
-            ProjectPolygon(poly_1, axis, minA, maxA);
-            ProjectPolygon(poly_2, axis, minB, maxB);
+            double minA, maxA;
+            ProjectVertices(world_boundary.vertices, axis, minA, maxA);
+            double projection = dot(point, axis);
 
-            if (maxA < minB || maxB < minA)
+            if (projection < minA || projection > maxA)
+            {
                 return false;
+            }
         }
-
         return true;
     }
 
-}
\ No newline at end of file
+}
@@ -1,7 +1,10 @@
 #pragma once
 #include "Component.hpp"
 #include "Polygon.h"
+#include "PolygonEdges.hpp"
 #include "Rect.hpp"
+#include <cstdint>
+#include <vector>
 
 namespace Math
 {
@@ -12,6 +15,14 @@ namespace CS230
 {
     class GameObject;
 
+    // Narrowphase result. normal is a unit vector pointing from the first collider toward the second;
+    // moving the second by normal * depth (or the first by -normal * depth) separates them.
+    struct Contact
+    {
+        Math::vec2 normal;
+        double     depth = 0.0;
+    };
+
     class Collision : public Component
     {
     public:
@@ -23,10 +34,25 @@ namespace CS230
         };
         virtual CollisionShape Shape()                                                = 0;
         virtual void           Draw(const Math::TransformationMatrix& display_matrix) = 0;
-        virtual bool           IsCollidingWith(GameObject* other_object)              = 0;
         virtual bool           IsCollidingWith(Math::vec2 point)                      = 0;
+        virtual Math::rect     WorldBoundingBox()                                     = 0;
+
+        // Narrowphase against the other object's collider; false when it has none
+        bool IsCollidingWith(GameObject* other_object, Contact* contact = nullptr);
+
+    protected:
+        // True the first time and whenever the owner has moved since the last call
+        bool TransformChanged(const GameObject* owner);
+
+    private:
+        uint32_t cached_transform_version = 0;
+        bool     has_cached_transform     = false;
     };
 
+    // Narrowphase for any pair of colliders through a Shape() x Shape() table of free functions over the
+    // cached world shapes. contact is only written when the shapes overlap.
+    bool Collide(Collision& a, Collision& b, Contact* contact = nullptr);
+
     class RectCollision : public Collision
     {
     public:
@@ -37,14 +63,17 @@ namespace CS230
             return CollisionShape::Rect;
         }
 
+        using Collision::IsCollidingWith;
+
         void         Draw(const Math::TransformationMatrix& display_matrix) override;
         Math::rect   WorldBoundary();
-        bool         IsCollidingWith(GameObject* other_object) override;
+        Math::rect   WorldBoundingBox() override;
         virtual bool IsCollidingWith(Math::vec2 point) override;
 
     private:
         Math::irect boundary;
         GameObject* object;
+        Math::rect  world_rect;
     };
 
     class CircleCollision : public Collision
@@ -57,9 +86,12 @@ namespace CS230
             return CollisionShape::Circle;
         }
 
+        using Collision::IsCollidingWith;
+
         void         Draw(const Math::TransformationMatrix& display_matrix) override;
         double       GetRadius();
-        bool         IsCollidingWith(GameObject* other_object) override;
+        Math::vec2   WorldCenter() const;
+        Math::rect   WorldBoundingBox() override;
         virtual bool IsCollidingWith(Math::vec2 point) override;
 
     private:
@@ -77,13 +109,29 @@ namespace CS230
             return CollisionShape::Poly;
         }
 
-        void         Draw(const Math::TransformationMatrix& display_matrix) override;
-        Polygon      WorldBoundary();
-        bool         IsCollidingWith(GameObject* other_object) override;
-        virtual bool IsCollidingWith(Math::vec2 point) override;
+        using Collision::IsCollidingWith;
+
+        void           Draw(const Math::TransformationMatrix& display_matrix) override;
+        const Polygon& WorldBoundary();
+        Math::rect     WorldBoundingBox() override;
+        virtual bool   IsCollidingWith(Math::vec2 point) override;
+
+        // Unit normal of each world edge; normal i belongs to the edge from vertex i to vertex i + 1
+        const std::vector<Math::vec2>& WorldEdgeNormals();
+
+        // Classified world edges for terrain resolution; rebuilt lazily the first time they are asked for after the owner moves
+        const PolygonEdges& WorldEdges();
 
     private:
+        void UpdateWorldGeometry();
+
         Polygon     boundary;
         GameObject* object;
+
+        Polygon                 world_boundary;
+        std::vector<Math::vec2> world_normals;
+        Math::rect              world_bounding_box;
+        PolygonEdges            world_edges;
+        bool                    world_edges_dirty = true;
     };
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "CollisionLayers.hpp"
+
+namespace
+{
+    static_assert(GameObjectTypeSlots <= 32, "Collision layers are stored in 32-bit masks");
+
+    constexpr uint32_t Bit(GameObjectTypes type)
+    {
+        return uint32_t{ 1 } << static_cast<uint32_t>(type);
+    }
+}
+
+namespace CS230
+{
+    CollisionLayer GetCollisionLayer(GameObjectTypes type)
+    {
+        CollisionLayer result;
+        result.layer = Bit(type);
+
+        // Keep in sync with the CanCollideWith overrides in Game/
+        switch (type)
+        {
+            case GameObjectTypes::Player:
+                result.mask = Bit(GameObjectTypes::Floor) | Bit(GameObjectTypes::Sign) | Bit(GameObjectTypes::Bonfire) | Bit(GameObjectTypes::Door) | Bit(GameObjectTypes::PushableMirror) |
+                              Bit(GameObjectTypes::Gate) | Bit(GameObjectTypes::FallingBlock) | Bit(GameObjectTypes::Elevator) | Bit(GameObjectTypes::BreakableWall) | Bit(GameObjectTypes::Spike);
+                break;
+            case GameObjectTypes::FallingBlock: result.mask = Bit(GameObjectTypes::Floor) | Bit(GameObjectTypes::Gate) | Bit(GameObjectTypes::Player); break;
+            case GameObjectTypes::PushableMirror: result.mask = Bit(GameObjectTypes::Floor); break;
+            case GameObjectTypes::Gate:
+            case GameObjectTypes::BreakableWall:
+            case GameObjectTypes::Spike: result.mask = Bit(GameObjectTypes::Player); break;
+            default: result.mask = 0; break;
+        }
+        return result;
+    }
+
+    const char* GetTypeName(GameObjectTypes type)
+    {
+        switch (type)
+        {
+            case GameObjectTypes::Player: return "Player";
+            case GameObjectTypes::Floor: return "Floor";
+            case GameObjectTypes::Laser: return "Laser";
+            case GameObjectTypes::Star: return "Star";
+            case GameObjectTypes::Boss: return "Boss";
+            case GameObjectTypes::Target: return "Target";
+            case GameObjectTypes::Sign: return "Sign";
+            case GameObjectTypes::Bonfire: return "Bonfire";
+            case GameObjectTypes::Particle: return "Particle";
+            case GameObjectTypes::Door: return "Door";
+            case GameObjectTypes::Mirror: return "Mirror";
+            case GameObjectTypes::PushableMirror: return "PushableMirror";
+            case GameObjectTypes::Gate: return "Gate";
+            case GameObjectTypes::LaserCutRope: return "LaserCutRope";
+            case GameObjectTypes::FallingBlock: return "FallingBlock";
+            case GameObjectTypes::LaserTurret: return "LaserTurret";
+            case GameObjectTypes::Water: return "Water";
+            case GameObjectTypes::BreakableWall: return "BreakableWall";
+            case GameObjectTypes::Staircase: return "Staircase";
+            case GameObjectTypes::Spike: return "Spike";
+            case GameObjectTypes::Elevator: return "Elevator";
+            case GameObjectTypes::BullBoss: return "BullBoss";
+            case GameObjectTypes::Count: return "Count";
+            case GameObjectTypes::Background: return "Background";
+            case GameObjectTypes::Pillar: return "Pillar";
+        }
+        return "Unknown";
+    }
+
+    CollisionMatrix::CollisionMatrix()
+    {
+        for (size_t a = 0; a < GameObjectTypeSlots; ++a)
+        {
+            const uint32_t mask = GetCollisionLayer(static_cast<GameObjectTypes>(a)).mask;
+            for (size_t b = 0; b < GameObjectTypeSlots; ++b)
+            {
+                const CollisionLayer other = GetCollisionLayer(static_cast<GameObjectTypes>(b));
+                if ((mask & other.layer) != 0)
+                {
+                    rows[a] |= uint32_t{ 1 } << static_cast<uint32_t>(b);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "GameObjectTypes.hpp"
+#include <array>
+#include <cstdint>
+
+namespace CS230
+{
+    // Which layer a type lives on and which layers it wants to hear about.
+    // The mask must cover every type the class' CanCollideWith can accept;
+    // CanCollideWith still runs after the mask for state-dependent cases such as an open Gate.
+    struct CollisionLayer
+    {
+        uint32_t layer = 0;
+        uint32_t mask  = 0;
+    };
+
+    CollisionLayer GetCollisionLayer(GameObjectTypes type);
+    const char*    GetTypeName(GameObjectTypes type);
+
+    // Row a has bit b set when objects of type a should be tested against objects of type b
+    class CollisionMatrix
+    {
+    public:
+        CollisionMatrix();
+
+        bool CanPair(GameObjectTypes type_1, GameObjectTypes type_2) const
+        {
+            return (rows[static_cast<size_t>(type_1)] & (uint32_t{ 1 } << static_cast<uint32_t>(type_2))) != 0;
+        }
+
+        // Types with an empty row never start a pair test (floors, walls, decoration)
+        bool IsPassive(GameObjectTypes type) const
+        {
+            return rows[static_cast<size_t>(type)] == 0;
+        }
+
+        uint32_t Row(GameObjectTypes type) const
+        {
+            return rows[static_cast<size_t>(type)];
+        }
+
+    private:
+        std::array<uint32_t, GameObjectTypeSlots> rows{};
+    };
+}
@@ -31,20 +31,36 @@ namespace CS230
         void AddComponent(Component* component)
         {
             components.push_back(component);
+            lookup.clear();
         }
 
+        // After the first call for a given T this is a single array read.
+        // The first call scans with dynamic_cast, so asking for a base class (e.g. Collision) still works.
         template <typename T>
         T* GetComponent()
         {
+            const size_t id = TypeId<T>();
+            if (id < lookup.size() && lookup[id].cached)
+            {
+                return static_cast<T*>(lookup[id].component);
+            }
+
+            T* found = nullptr;
             for (Component* component : components)
             {
-                T* ptr = dynamic_cast<T*>(component);
-                if (ptr != nullptr)
+                found = dynamic_cast<T*>(component);
+                if (found != nullptr)
                 {
-                    return ptr;
+                    break;
                 }
             }
-            return nullptr;
+
+            if (id >= lookup.size())
+            {
+                lookup.resize(id + 1);
+            }
+            lookup[id] = { found, true };
+            return found;
         }
 
         template <typename T>
@@ -53,6 +69,7 @@ namespace CS230
             auto it = std::find_if(components.begin(), components.end(), [](Component* element) { return (dynamic_cast<T*>(element) != nullptr); });
             delete *it;
             components.erase(it);
+            lookup.clear();
         }
 
         void Clear()
@@ -62,9 +79,31 @@ namespace CS230
                 delete component;
             }
             components.clear();
+            lookup.clear();
         }
 
     private:
-        std::vector<Component*> components;
+        // Ids are handed out the first time each type is looked up, so they stay small and dense
+        static size_t NextTypeId()
+        {
+            static size_t next_id = 0;
+            return next_id++;
+        }
+
+        template <typename T>
+        static size_t TypeId()
+        {
+            static const size_t id = NextTypeId();
+            return id;
+        }
+
+        struct LookupEntry
+        {
+            Component* component = nullptr;
+            bool       cached    = false;
+        };
+
+        std::vector<Component*>  components;
+        std::vector<LookupEntry> lookup;
     };
 }
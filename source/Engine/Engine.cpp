@@ -7,24 +7,33 @@
  * \copyright DigiPen Institute of Technology
  */
 #include "Engine.hpp"
+#include "CS200/BatchRenderer2D.hpp"
 #include "CS200/ImGuiHelper.hpp"
 #include "CS200/ImmediateRenderer2D.hpp"
+#include "CS200/InstancedRenderer2D.hpp"
 #include "CS200/NDC.hpp"
+#include "CS200/NullRenderer2D.hpp"
 #include "CS200/RenderingAPI.hpp"
+#include "OpenGL/GL.hpp"
 #include "AudioManager.hpp"
 #include "FPS.hpp"
 #include "Font.hpp"
 #include "GameState.hpp"
 #include "GameStateManager.hpp"
 #include "Input.hpp"
+#include "InputRecording.hpp"
 #include "Logger.hpp"
+#include "Random.hpp"
 #include "SettingsManager.hpp"
 #include "TextureManager.hpp"
 #include "Timer.hpp"
 #include "Window.hpp"
+#include "WorkerPool.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <string>
 #include <thread>
 
 // Pimpl implementation class
@@ -52,10 +61,37 @@ public:
     WindowEnvironment                         environment{};
     CS230::GameStateManager                   gameStateManager{};
     CS200::ImmediateRenderer2D                renderer2D{};
+    CS200::BatchRenderer2D                    batchRenderer2D{};
+    CS200::InstancedRenderer2D                instancedRenderer2D{};
+    CS200::NullRenderer2D                     nullRenderer2D{};
+    CS200::IRenderer2D*                       activeRenderer2D        = &renderer2D;
+    Renderer2DType                            renderer2DType          = Renderer2DType::Immediate;
+    bool                                      renderersStarted        = false;
+    bool                                      batchRenderer2DInit     = false;
+    bool                                      instancedRenderer2DInit = false;
     CS230::TextureManager                     textureManager{};
     std::vector<std::unique_ptr<CS230::Font>> fonts;
+    CS230::WorkerPool                         workerPool{};
+    double                                    accumulator = 0.0;
+    bool                                      headless    = false;
+    double                                    headlessDt  = 0.0;
+    CS230::InputRecorder                      recorder{};
+    CS230::InputReplayer                      replayer{};
+    CS230::InputFrame                         replayFrame{};
+    bool                                      replayFinished = false;
 };
 
+std::optional<Renderer2DType> ParseRenderer2DType(std::string_view name)
+{
+    if (name == "immediate")
+        return Renderer2DType::Immediate;
+    if (name == "batch")
+        return Renderer2DType::Batch;
+    if (name == "instanced")
+        return Renderer2DType::Instanced;
+    return std::nullopt;
+}
+
 Engine& Engine::Instance()
 {
     static Engine instance;
@@ -89,7 +125,17 @@ CS230::GameStateManager& Engine::GetGameStateManager()
 
 CS200::IRenderer2D& Engine::GetRenderer2D()
 {
-    return Instance().impl->renderer2D;
+    Impl* const instance = Instance().impl;
+    if (instance->headless)
+    {
+        return instance->nullRenderer2D;
+    }
+    return *instance->activeRenderer2D;
+}
+
+bool Engine::IsHeadless()
+{
+    return Instance().impl->headless;
 }
 
 CS230::TextureManager& Engine::GetTextureManager()
@@ -102,11 +148,56 @@ CS230::Font& Engine::GetFont(int index)
     return *Instance().impl->fonts.at(static_cast<size_t>(index));
 }
 
+CS230::WorkerPool& Engine::GetWorkerPool()
+{
+    return Instance().impl->workerPool;
+}
+
 void Engine::AddFont(const std::filesystem::path& file_name)
 {
     impl->fonts.push_back(std::make_unique<CS230::Font>(file_name));
 }
 
+void Engine::SetRenderer2D(Renderer2DType type)
+{
+    impl->renderer2DType = type;
+    if (!impl->renderersStarted)
+    {
+        // Start() picks it up once there is a GL context
+        return;
+    }
+
+    CS200::IRenderer2D* next = &impl->renderer2D;
+    const char*         name = "ImmediateRenderer2D";
+    bool*               init = nullptr;
+    switch (type)
+    {
+        case Renderer2DType::Immediate: break;
+        case Renderer2DType::Batch:
+            next = &impl->batchRenderer2D;
+            name = "BatchRenderer2D";
+            init = &impl->batchRenderer2DInit;
+            break;
+        case Renderer2DType::Instanced:
+            next = &impl->instancedRenderer2D;
+            name = "InstancedRenderer2D";
+            init = &impl->instancedRenderer2DInit;
+            break;
+    }
+
+    if (init != nullptr && !*init)
+    {
+        next->Init();
+        *init = true;
+    }
+
+    if (next != impl->activeRenderer2D)
+    {
+        impl->activeRenderer2D = next;
+        impl->logger.LogEvent(std::string("Using ") + name);
+    }
+}
+
 void Engine::Start(std::string_view window_title)
 {
     impl->logger.LogEvent("Engine Started");
@@ -124,12 +215,81 @@ void Engine::Start(std::string_view window_title)
     ImGuiHelper::Initialize(window.GetSDLWindow(), window.GetGLContext());
     window.SetEventCallback(ImGuiHelper::FeedEvent);
     impl->renderer2D.Init();
+    impl->renderersStarted = true;
+    SetRenderer2D(impl->renderer2DType);
     impl->timer.ResetTimeStamp();
 }
 
+void Engine::StartHeadless(Math::ivec2 display_size, double fixed_dt)
+{
+    impl->logger.LogEvent("Engine Started (headless)");
+    impl->headless   = true;
+    impl->headlessDt = fixed_dt;
+    impl->window.StartHeadless(display_size);
+    ImGuiHelper::InitializeHeadless();
+
+    impl->viewport                = { 0, 0, display_size.x, display_size.y };
+    impl->environment.DisplaySize = { static_cast<double>(display_size.x), static_cast<double>(display_size.y) };
+    impl->nullRenderer2D.Init();
+    impl->timer.ResetTimeStamp();
+}
+
+bool Engine::StartRecording(const std::filesystem::path& file_path)
+{
+    const uint64_t seed = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    if (!impl->recorder.Open(file_path, seed))
+    {
+        impl->logger.LogError("Could not open input recording " + file_path.string());
+        return false;
+    }
+    util::seed_random(seed);
+    impl->logger.LogEvent("Recording input to " + file_path.string());
+    return true;
+}
+
+bool Engine::StartReplay(const std::filesystem::path& file_path)
+{
+    if (!impl->replayer.Open(file_path))
+    {
+        impl->logger.LogError("Could not open input replay " + file_path.string());
+        return false;
+    }
+    util::seed_random(impl->replayer.GetSeed());
+    impl->replayFinished = false;
+    impl->logger.LogEvent("Replaying input from " + file_path.string());
+    return true;
+}
+
 void Engine::Stop()
 {
+    if (impl->recorder.IsOpen())
+    {
+        impl->logger.LogEvent("Recorded " + std::to_string(impl->recorder.FrameCount()) + " input frames");
+        impl->recorder.Close();
+    }
+    impl->replayer.Close();
+
+    if (impl->headless)
+    {
+        impl->gameStateManager.Clear();
+        ImGuiHelper::Shutdown();
+        impl->logger.LogEvent("Engine Stopped");
+        return;
+    }
+
     impl->renderer2D.Shutdown();
+    if (impl->batchRenderer2DInit)
+    {
+        impl->batchRenderer2D.Shutdown();
+        impl->batchRenderer2DInit = false;
+    }
+    if (impl->instancedRenderer2DInit)
+    {
+        impl->instancedRenderer2D.Shutdown();
+        impl->instancedRenderer2DInit = false;
+    }
+    impl->activeRenderer2D = &impl->renderer2D;
+    impl->renderersStarted = false;
     impl->gameStateManager.Clear();
     AudioManager::Shutdown();
     ImGuiHelper::Shutdown();
@@ -138,16 +298,55 @@ void Engine::Stop()
 
 void Engine::Update()
 {
+    if (impl->replayer.IsOpen() && !impl->replayer.Read(impl->replayFrame))
+    {
+        impl->logger.LogEvent("Replay finished after " + std::to_string(impl->replayer.FrameCount()) + " frames");
+        impl->replayer.Close();
+        impl->replayFinished = true;
+        return;
+    }
+
     updateEnvironment();
-    impl->window.Update();
-    impl->input.Update();
     auto& state_manager = impl->gameStateManager;
-    // state_manager.Update();
-    state_manager.Update(impl->environment.DeltaTime);
-    const auto        viewport      = impl->viewport;
-    const Math::ivec2 viewport_size = { viewport.width, viewport.height };
+    if (impl->headless && !impl->replayer.IsOpen())
+    {
+        // No live input, no drawing: just the simulation
+        state_manager.Update(impl->environment.DeltaTime);
+        return;
+    }
+
+    if (!impl->headless)
+    {
+        impl->window.Update();
+    }
+    if (CS230::SettingsManager::Instance().IsFixedTimestep())
+    {
+        updateFixedSteps();
+    }
+    else
+    {
+        updateInput();
+        impl->accumulator                    = 0.0;
+        impl->environment.InterpolationAlpha = 1.0;
+        // state_manager.Update();
+        state_manager.Update(impl->environment.DeltaTime);
+    }
+    recordFrame();
+    if (impl->headless)
+    {
+        return;
+    }
+
+    const auto        viewport          = impl->viewport;
+    const Math::ivec2 viewport_size     = { viewport.width, viewport.height };
+    const auto        gl_state_before   = GL::GetStateCacheStats();
+    const uint64_t    draw_calls_before = impl->activeRenderer2D->GetDrawCallCount();
     CS200::RenderingAPI::SetViewport(viewport_size, { viewport.x, viewport.y });
     state_manager.Draw();
+    const auto gl_state_after            = GL::GetStateCacheStats();
+    impl->environment.DrawCalls          = impl->activeRenderer2D->GetDrawCallCount() - draw_calls_before;
+    impl->environment.GLStateCallsIssued = gl_state_after.Issued - gl_state_before.Issued;
+    impl->environment.GLStateCallsElided = gl_state_after.Elided - gl_state_before.Elided;
     impl->viewport = ImGuiHelper::Begin();
     state_manager.DrawImGui();
     ImGuiHelper::End();
@@ -155,7 +354,7 @@ void Engine::Update()
 
 bool Engine::HasGameEnded()
 {
-    return impl->window.IsClosed() || impl->gameStateManager.HasGameEnded();
+    return impl->window.IsClosed() || impl->gameStateManager.HasGameEnded() || impl->replayFinished;
 }
 
 Engine::Engine() : impl(new Impl())
@@ -172,6 +371,17 @@ void Engine::updateEnvironment()
     auto&  environment       = impl->environment;
     double actualElaspedTime = impl->timer.GetElapsedSeconds();
 
+    if (impl->headless)
+    {
+        impl->timer.ResetTimeStamp();
+        environment.DeltaTime    = impl->replayer.IsOpen() ? impl->replayFrame.delta_time : impl->headlessDt;
+        environment.ElapsedTime += environment.DeltaTime;
+        ++environment.FrameCount;
+        impl->fps.Update(actualElaspedTime);
+        environment.FPS = impl->fps;
+        return;
+    }
+
     const int frameLimit = CS230::SettingsManager::Instance().GetFrameLimit();
     if (frameLimit > 0)
     {
@@ -184,6 +394,11 @@ void Engine::updateEnvironment()
     }
 
     environment.DeltaTime    = (actualElaspedTime > 0.05) ? 0.05 : actualElaspedTime;
+    if (impl->replayer.IsOpen())
+    {
+        // Replays advance by the recorded dt so the simulation matches regardless of how fast this run is
+        environment.DeltaTime = impl->replayFrame.delta_time;
+    }
     impl->timer.ResetTimeStamp();
     environment.ElapsedTime += environment.DeltaTime;
     ++environment.FrameCount;
@@ -192,3 +407,60 @@ void Engine::updateEnvironment()
     const auto viewport           = impl->viewport;
     impl->environment.DisplaySize = { static_cast<double>(viewport.width), static_cast<double>(viewport.height) };
 }
+
+void Engine::updateFixedSteps()
+{
+    const auto&  settings      = CS230::SettingsManager::Instance().GetSettings();
+    const double step          = 1.0 / static_cast<double>(settings.tickRate);
+    auto&        state_manager = impl->gameStateManager;
+
+    impl->accumulator += impl->environment.DeltaTime;
+    const int steps = std::min(static_cast<int>(impl->accumulator / step), settings.maxCatchUpSteps);
+
+    // Frames that run no tick leave the input untouched so presses are not lost before the next tick sees them
+    if (steps > 0)
+    {
+        updateInput();
+    }
+
+    for (int i = 0; i < steps; ++i)
+    {
+        state_manager.Update(step);
+        impl->accumulator -= step;
+        // JustPressed/JustReleased belong to the first tick of the frame only
+        impl->input.ConsumeTransitions();
+    }
+
+    // Too far behind to catch up: drop the backlog instead of spiralling
+    if (impl->accumulator >= step)
+    {
+        impl->accumulator = std::fmod(impl->accumulator, step);
+    }
+
+    impl->environment.InterpolationAlpha = impl->accumulator / step;
+}
+
+void Engine::updateInput()
+{
+    if (impl->replayer.IsOpen())
+    {
+        impl->input.UpdateFromFrame(impl->replayFrame);
+    }
+    else
+    {
+        impl->input.Update();
+    }
+}
+
+void Engine::recordFrame()
+{
+    if (!impl->recorder.IsOpen())
+    {
+        return;
+    }
+
+    // Capture is taken after the update so a frame that sampled no input records the state it kept
+    CS230::InputFrame frame = impl->input.Capture();
+    frame.delta_time        = impl->environment.DeltaTime;
+    impl->recorder.Write(frame);
+}
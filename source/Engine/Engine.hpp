@@ -11,6 +11,7 @@
 #include "Vec2.hpp"
 #include <gsl/gsl>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <filesystem>
 
@@ -23,6 +24,7 @@ namespace CS230
     class GameStateManager;
     class TextureManager;
     class Font;
+    class WorkerPool;
 }
 
 namespace CS200
@@ -37,8 +39,25 @@ struct WindowEnvironment
     double     DeltaTime   = 0.0;
     double     ElapsedTime = 0.0;
     Math::vec2 DisplaySize{};
+    // How far rendering sits between the previous and the current fixed tick (1 when fixed timestep is off)
+    double InterpolationAlpha = 1.0;
+    // Draw calls the active renderer issued while drawing the previous frame
+    uint64_t DrawCalls = 0;
+    // State changes that reached the driver / were skipped as redundant while drawing the previous frame
+    uint64_t GLStateCallsIssued = 0;
+    uint64_t GLStateCallsElided = 0;
 };
 
+enum class Renderer2DType
+{
+    Immediate,
+    Batch,
+    Instanced
+};
+
+// "immediate", "batch" or "instanced" (as used by settings.cfg and --renderer=); anything else yields no value
+[[nodiscard]] std::optional<Renderer2DType> ParseRenderer2DType(std::string_view name);
+
 class Engine
 {
 public:
@@ -51,10 +70,22 @@ public:
     static CS200::IRenderer2D& GetRenderer2D();
     static CS230::TextureManager& GetTextureManager();
     static CS230::Font& GetFont(int index);
+    static CS230::WorkerPool& GetWorkerPool();
     void AddFont(const std::filesystem::path& file_name);
+    // Chooses what GetRenderer2D hands out. Call between frames, never inside a BeginScene/EndScene pair.
+    // The batch and instanced renderers are initialized the first time they are picked; headless runs keep the null renderer.
+    void SetRenderer2D(Renderer2DType type);
 
 public:
     void Start(std::string_view window_title);
+    // Runs game states without SDL video, GL, ImGui or audio. Every Update advances
+    // exactly fixed_dt seconds as fast as possible and skips drawing.
+    void StartHeadless(Math::ivec2 display_size, double fixed_dt);
+    static bool IsHeadless();
+    // Call after Start/StartHeadless and before the first state is pushed. Both reseed util::random
+    // so a replay sees the same random numbers as the recorded run.
+    bool StartRecording(const std::filesystem::path& file_path);
+    bool StartReplay(const std::filesystem::path& file_path);
     void Stop();
     void Update();
     bool HasGameEnded();
@@ -68,4 +99,7 @@ private:
     ~Engine();
 
     void updateEnvironment();
+    void updateFixedSteps();
+    void updateInput();
+    void recordFrame();
 };
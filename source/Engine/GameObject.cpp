@@ -7,6 +7,7 @@
  */
 
 #include "GameObject.hpp"
+#include "Affine.hpp"
 #include "Collision.hpp"
 #include "Engine.hpp"
 #include "GameStateManager.hpp"
@@ -20,7 +21,7 @@ namespace CS230
     {
     }
 
-    GameObject::GameObject(Math::vec2 pos, double rot, Math::vec2 sc) : current_state(&state_none), matrix_outdated(true), rotation(rot), scale(sc), position(pos), velocity({ 0, 0 }), destroy(false)
+    GameObject::GameObject(Math::vec2 pos, double rot, Math::vec2 sc) : current_state(&state_none), matrix_outdated(true), rotation(rot), scale(sc), position(pos), velocity({ 0, 0 }), previous_position(pos), previous_rotation(rot), destroy(false)
     {
     }
 
@@ -40,7 +41,7 @@ namespace CS230
         Sprite* sprite = GetGOComponent<Sprite>();
         if (sprite != nullptr)
         {
-            sprite->Draw(camera_matrix * GetMatrix());
+            sprite->Draw(camera_matrix * GetRenderMatrix());
         }
 
         auto show_collision = Engine::GetGameStateManager().GetGSComponent<CS230::ShowCollision>();
@@ -75,12 +76,40 @@ namespace CS230
     {
         if (matrix_outdated)
         {
-            object_matrix   = Math::TranslationMatrix(position) * Math::RotationMatrix(rotation) * Math::ScaleMatrix(scale);
+            object_matrix   = Math::AffineMatrix::TRS(position, rotation, scale).ToMatrix();
             matrix_outdated = false;
         }
         return object_matrix;
     }
 
+    Math::TransformationMatrix GameObject::GetRenderMatrix()
+    {
+        const double alpha = Engine::GetWindowEnvironment().InterpolationAlpha;
+        if (alpha >= 1.0 || (previous_position == position && previous_rotation == rotation))
+        {
+            return GetMatrix();
+        }
+
+        const double render_rotation = previous_rotation + (rotation - previous_rotation) * alpha;
+        return Math::AffineMatrix::TRS(GetRenderPosition(), render_rotation, scale).ToMatrix();
+    }
+
+    Math::vec2 GameObject::GetRenderPosition() const
+    {
+        const double alpha = Engine::GetWindowEnvironment().InterpolationAlpha;
+        if (alpha >= 1.0)
+        {
+            return position;
+        }
+        return previous_position + (position - previous_position) * alpha;
+    }
+
+    void GameObject::SnapshotTransform()
+    {
+        previous_position = position;
+        previous_rotation = rotation;
+    }
+
     const Math::vec2& GameObject::GetPosition() const
     {
         return position;
@@ -103,14 +132,20 @@ namespace CS230
 
     void GameObject::SetPosition(Math::vec2 new_position)
     {
-        position        = new_position;
-        matrix_outdated = true;
+        position = new_position;
+        MarkTransformDirty();
+    }
+
+    void GameObject::Teleport(Math::vec2 new_position)
+    {
+        SetPosition(new_position);
+        SnapshotTransform();
     }
 
     void GameObject::UpdatePosition(Math::vec2 delta)
     {
         position += delta;
-        matrix_outdated = true;
+        MarkTransformDirty();
     }
 
     void GameObject::SetVelocity(Math::vec2 new_velocity)
@@ -125,26 +160,32 @@ namespace CS230
 
     void GameObject::SetScale(Math::vec2 new_scale)
     {
-        scale           = new_scale;
-        matrix_outdated = true;
+        scale = new_scale;
+        MarkTransformDirty();
     }
 
     void GameObject::UpdateScale(Math::vec2 delta)
     {
         scale += delta;
-        matrix_outdated = true;
+        MarkTransformDirty();
     }
 
     void GameObject::SetRotation(double new_rotation)
     {
-        rotation        = new_rotation;
-        matrix_outdated = true;
+        rotation = new_rotation;
+        MarkTransformDirty();
     }
 
     void GameObject::UpdateRotation(double delta)
     {
         rotation += delta;
+        MarkTransformDirty();
+    }
+
+    void GameObject::MarkTransformDirty()
+    {
         matrix_outdated = true;
+        ++transform_version;
     }
 
     void GameObject::change_state(State* new_state)
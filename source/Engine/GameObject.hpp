@@ -7,12 +7,20 @@
  */
 #pragma once
 #include "ComponentManager.hpp"
+#include "GameObjectHandle.hpp"
 #include "Matrix.hpp"
+#include "Rect.hpp"
 #include "Sprite.hpp"
 #include "Vec2.hpp"
+#include <vector>
 
 enum class GameObjectTypes;
 
+namespace Physics
+{
+    struct LineSegment;
+}
+
 namespace CS230
 {
     class Component;
@@ -21,6 +29,7 @@ namespace CS230
     {
     public:
         friend class Sprite;
+        friend class GameObjectManager;
         GameObject(Math::vec2 pos);
         GameObject(Math::vec2 pos, double rot, Math::vec2 sc);
 
@@ -40,13 +49,44 @@ namespace CS230
         virtual void Interact([[maybe_unused]] GameObject* other_object) { };
         virtual void DrawImGui() { };
 
+        // Segments this object puts in the way of laser beams (mirrors, closed gates).
+        // GameObjectManager caches the result until the object moves or InvalidateLaserOccluders is called.
+        virtual void AppendLaserSegments([[maybe_unused]] std::vector<Physics::LineSegment>& out) { };
+
+        // Half extent around the position that GameObjectManager::QueryCapsule indexes for objects without a Collision
+        virtual double GetQueryRadius() const
+        {
+            return 0.0;
+        }
+
+        // World-space region this object registers in GameObjectManager's trigger volumes (water, hazard, reading range).
+        // Read when the object is added and again whenever it moves; false for objects without one.
+        virtual bool GetTriggerBounds([[maybe_unused]] Math::rect& bounds) const
+        {
+            return false;
+        }
+
         const Math::TransformationMatrix& GetMatrix();
         const Math::vec2&                 GetPosition() const;
         const Math::vec2&                 GetVelocity() const;
         const Math::vec2&                 GetScale() const;
         double                            GetRotation() const;
 
+        // Transform blended between the last two fixed ticks for drawing.
+        // Same as GetMatrix()/GetPosition() when the fixed timestep is off.
+        Math::TransformationMatrix GetRenderMatrix();
+        Math::vec2                 GetRenderPosition() const;
+
         void SetPosition(Math::vec2 new_position);
+        // SetPosition for discontinuous moves (respawn, teleport, reuse): also resets the interpolation
+        // start so the next draw does not sweep across the jump
+        void Teleport(Math::vec2 new_position);
+
+        // Bumped on every position/rotation/scale change so components can cache world-space data
+        uint32_t GetTransformVersion() const
+        {
+            return transform_version;
+        }
 
         template <typename T>
         T* GetGOComponent()
@@ -66,6 +106,12 @@ namespace CS230
         void Destroy();
         bool Destroyed() const;
 
+        // Null until the object is added to a GameObjectManager
+        GameObjectHandle GetHandle() const
+        {
+            return handle;
+        }
+
     protected:
         void UpdatePosition(Math::vec2 delta);
         void SetVelocity(Math::vec2 new_velocity);
@@ -110,13 +156,20 @@ namespace CS230
         }
 
     private:
+        void MarkTransformDirty();
+        // Called by GameObjectManager before each tick so the draw can interpolate from here
+        void SnapshotTransform();
+
         Math::TransformationMatrix object_matrix;
-        bool                       matrix_outdated = true;
+        bool                       matrix_outdated   = true;
+        uint32_t                   transform_version = 0;
 
         double      rotation;
         Math::vec2  scale;
         Math::vec2  position;
         Math::vec2  velocity;
+        Math::vec2  previous_position;
+        double      previous_rotation;
 
         std::string name;
         bool isVisible = true;
@@ -139,5 +192,7 @@ namespace CS230
         ComponentManager componentmanager;
 
         bool destroy;
+
+        GameObjectHandle handle;
     };
 }
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <cstdint>
+
+namespace CS230
+{
+    // Weak reference to an object owned by a GameObjectManager.
+    // The generation changes when the slot is reused, so a handle to a deleted object
+    // resolves to nullptr instead of whatever object took its place.
+    struct GameObjectHandle
+    {
+        static constexpr uint32_t invalid_index = 0xFFFFFFFFu;
+
+        uint32_t index      = invalid_index;
+        uint32_t generation = 0;
+
+        bool IsNull() const
+        {
+            return index == invalid_index;
+        }
+
+        bool operator==(const GameObjectHandle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+    };
+}
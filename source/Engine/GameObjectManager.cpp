@@ -7,32 +7,144 @@
  */
 
 #include "GameObjectManager.hpp"
+#include "Collision.hpp"
 #include "Engine.hpp"
 #include "Logger.hpp"
+#include "MapElement.h"
+#include <algorithm>
+
+namespace
+{
+    bool Overlaps(const Math::rect& a, const Math::rect& b)
+    {
+        return a.Left() <= b.Right() && b.Left() <= a.Right() && a.Bottom() <= b.Top() && b.Bottom() <= a.Top();
+    }
+
+    bool SameSegment(const Physics::LineSegment& a, const Physics::LineSegment& b)
+    {
+        return a.p1.x == b.p1.x && a.p1.y == b.p1.y && a.p2.x == b.p2.x && a.p2.y == b.p2.y && a.isReflective == b.isReflective;
+    }
+
+    // Appends the segments of from that are not in in. Unchanged occluders keep their place in the
+    // gathered list, so the index-aligned check settles almost everything without a search.
+    void AppendMissing(const std::vector<Physics::LineSegment>& from, const std::vector<Physics::LineSegment>& in, std::vector<Physics::LineSegment>& out)
+    {
+        for (size_t i = 0; i < from.size(); ++i)
+        {
+            if (i < in.size() && SameSegment(from[i], in[i]))
+            {
+                continue;
+            }
+            if (std::none_of(in.begin(), in.end(), [&](const Physics::LineSegment& other) { return SameSegment(from[i], other); }))
+            {
+                out.push_back(from[i]);
+            }
+        }
+    }
+}
 
 namespace CS230
 {
 
-    void GameObjectManager::Add(GameObject* object)
+    GameObjectHandle GameObjectManager::Add(GameObject* object)
     {
+        uint32_t index;
+        if (!free_slots.empty())
+        {
+            index = free_slots.back();
+            free_slots.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        Slot& slot     = slots[index];
+        slot.object    = object;
+        slot.sequence  = next_sequence++;
+        slot.terrain   = object->Type() == GameObjectTypes::Floor && dynamic_cast<MapElement*>(object) != nullptr;
+        object->handle = { index, slot.generation };
+        terrain_dirty |= slot.terrain && terrain_enabled;
+
         objects.push_back(object);
+        type_buckets[BucketIndex(object->Type())].push_back(object);
+        query_synced_pass[BucketIndex(object->Type())] = 0;
+
+        if (Math::rect bounds; object->GetTriggerBounds(bounds))
+        {
+            trigger_stamps.push_back({ object->handle, object->GetTransformVersion(), object->IsActive() });
+            if (object->IsActive())
+            {
+                trigger_volumes.Set(object, bounds, slot.sequence, TriggerVolumes::Layer(object->Type()));
+            }
+        }
+        return object->handle;
+    }
+
+    GameObject* GameObjectManager::Get(GameObjectHandle handle) const
+    {
+        if (handle.index >= slots.size())
+        {
+            return nullptr;
+        }
+
+        const Slot& slot = slots[handle.index];
+        return slot.generation == handle.generation ? slot.object : nullptr;
+    }
+
+    void GameObjectManager::ReleaseSlot(GameObject* object)
+    {
+        Slot& slot = slots[object->handle.index];
+        terrain_dirty |= slot.terrain && terrain_enabled;
+        slot.object  = nullptr;
+        slot.terrain = false;
+        ++slot.generation;
+        free_slots.push_back(object->handle.index);
     }
 
     void GameObjectManager::Unload()
     {
         for (auto object : objects)
         {
+            ReleaseSlot(object);
             delete object;
         }
         objects.clear();
+        for (std::vector<GameObject*>& bucket : type_buckets)
+        {
+            bucket.clear();
+        }
+        broad_phase.Clear();
+        query_index.Clear();
+        query_synced_pass.fill(0);
+        trigger_volumes.Clear();
+        trigger_stamps.clear();
+        terrain_bvh.Clear();
+        terrain.clear();
+        terrain_segments.Clear();
+        terrain_enabled        = false;
+        terrain_dirty          = false;
+        terrain_segments_dirty = false;
+        laser_segments.clear();
+        laser_occluder_stamps.clear();
+        laser_segments_dirty = true;
     }
 
     void GameObjectManager::UpdateAll(double dt)
     {
-        std::vector<GameObject*> destroy_objects;
+        destroy_objects.clear();
+        ++update_pass;
 
-        for (auto object : objects)
+        for (GameObject* object : objects)
         {
+            object->SnapshotTransform();
+        }
+
+        // Indexed on purpose: objects added during Update land at the back and are updated this frame
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            GameObject* object = objects[i];
             if (object->IsActive())
             {
                 object->Update(dt);
@@ -43,18 +155,41 @@ namespace CS230
                 destroy_objects.push_back(object);
             }
         }
+        ++update_pass;
+
+        if (destroy_objects.empty())
+        {
+            return;
+        }
+
+        for (GameObject* obj : destroy_objects)
+        {
+            broad_phase.Remove(obj);
+            query_index.Remove(obj);
+            trigger_volumes.Remove(obj);
+            ReleaseSlot(obj);
+        }
+
+        // One stable compaction pass instead of a list search per destroyed object; keeps draw order
+        auto released = [this](GameObject* obj) { return slots[obj->handle.index].object != obj; };
+        objects.erase(std::remove_if(objects.begin(), objects.end(), released), objects.end());
+        for (std::vector<GameObject*>& bucket : type_buckets)
+        {
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(), released), bucket.end());
+        }
 
         for (GameObject* obj : destroy_objects)
         {
-            objects.remove(obj);
             delete obj;
         }
+        destroy_objects.clear();
     }
 
     void GameObjectManager::DrawAll(Math::TransformationMatrix camera_matrix)
     {
-        for (auto object : objects)
+        for (size_t i = 0; i < objects.size(); ++i)
         {
+            GameObject* object = objects[i];
             if (object->IsVisible())
             {
                 object->Draw(camera_matrix);
@@ -62,30 +197,375 @@ namespace CS230
         }
     }
 
+    void GameObjectManager::SyncBroadPhase()
+    {
+        for (GameObject* object : objects)
+        {
+            const Slot& slot = slots[object->handle.index];
+            if (slot.terrain && terrain_enabled)
+            {
+                continue;
+            }
+
+            Collision* collider = object->GetGOComponent<Collision>();
+            if (!object->IsActive() || collider == nullptr)
+            {
+                broad_phase.Remove(object);
+                continue;
+            }
+
+            broad_phase.Update(object, collider->WorldBoundingBox(), slot.sequence, TypeBit(object->Type()));
+        }
+    }
+
+    void GameObjectManager::BuildTerrain()
+    {
+        terrain_enabled = true;
+        RebuildTerrain();
+        for (MapElement* element : terrain)
+        {
+            broad_phase.Remove(element);
+        }
+    }
+
+    void GameObjectManager::RebuildTerrain()
+    {
+        terrain.clear();
+        std::vector<StaticBVH::Item> items;
+        for (GameObject* object : type_buckets[BucketIndex(GameObjectTypes::Floor)])
+        {
+            if (!slots[object->handle.index].terrain)
+            {
+                continue;
+            }
+
+            MapElement* element = static_cast<MapElement*>(object);
+            items.push_back({ element->GetWorldBounds(), static_cast<uint32_t>(terrain.size()) });
+            terrain.push_back(element);
+        }
+        terrain_bvh.Build(std::move(items));
+        terrain_dirty          = false;
+        terrain_segments_dirty = true;
+    }
+
+    void GameObjectManager::QueryTerrain(const Math::rect& bounds, std::vector<MapElement*>& out)
+    {
+        if (!terrain_enabled)
+        {
+            // Level still loading: no tree yet, so test every element directly
+            for (GameObject* object : type_buckets[BucketIndex(GameObjectTypes::Floor)])
+            {
+                if (slots[object->handle.index].terrain)
+                {
+                    MapElement* element = static_cast<MapElement*>(object);
+                    if (Overlaps(element->GetWorldBounds(), bounds))
+                    {
+                        out.push_back(element);
+                    }
+                }
+            }
+            return;
+        }
+
+        if (terrain_dirty)
+        {
+            RebuildTerrain();
+        }
+
+        terrain_query_ids.clear();
+        terrain_bvh.Query(bounds, terrain_query_ids);
+        for (uint32_t id : terrain_query_ids)
+        {
+            out.push_back(terrain[id]);
+        }
+    }
+
+    void GameObjectManager::SyncQueryIndex(GameObjectTypes type)
+    {
+        const size_t bucket_index = BucketIndex(type);
+        if (query_synced_pass[bucket_index] == update_pass)
+        {
+            return;
+        }
+        query_synced_pass[bucket_index] = update_pass;
+
+        for (GameObject* object : type_buckets[bucket_index])
+        {
+            if (!object->IsActive())
+            {
+                query_index.Remove(object);
+                continue;
+            }
+
+            Math::rect bounds;
+            if (Collision* collider = object->GetGOComponent<Collision>(); collider != nullptr)
+            {
+                bounds = collider->WorldBoundingBox();
+            }
+            else
+            {
+                const Math::vec2 extent{ object->GetQueryRadius(), object->GetQueryRadius() };
+                bounds = { object->GetPosition() - extent, object->GetPosition() + extent };
+            }
+            query_index.Update(object, bounds, slots[object->handle.index].sequence, TypeBit(type));
+        }
+    }
+
+    void GameObjectManager::QueryCapsule(Math::vec2 a, Math::vec2 b, double radius, GameObjectTypes type, std::vector<GameObject*>& out)
+    {
+        SyncQueryIndex(type);
+        query_index.QueryCapsule(a, b, radius, out, TypeBit(type));
+    }
+
+    void GameObjectManager::SyncTriggerVolumes()
+    {
+        if (trigger_synced_pass == update_pass)
+        {
+            return;
+        }
+        trigger_synced_pass = update_pass;
+
+        // Destroyed objects already left trigger_volumes; their stamps are dropped here
+        auto destroyed = [this](const TriggerStamp& stamp) { return Get(stamp.handle) == nullptr; };
+        trigger_stamps.erase(std::remove_if(trigger_stamps.begin(), trigger_stamps.end(), destroyed), trigger_stamps.end());
+
+        for (TriggerStamp& stamp : trigger_stamps)
+        {
+            GameObject* object = Get(stamp.handle);
+            if (!object->IsActive())
+            {
+                if (stamp.registered)
+                {
+                    trigger_volumes.Remove(object);
+                    stamp.registered = false;
+                }
+                continue;
+            }
+
+            if (stamp.registered && stamp.transform_version == object->GetTransformVersion())
+            {
+                continue;
+            }
+
+            Math::rect bounds;
+            if (object->GetTriggerBounds(bounds))
+            {
+                trigger_volumes.Set(object, bounds, slots[stamp.handle.index].sequence, TriggerVolumes::Layer(object->Type()));
+                stamp.registered = true;
+            }
+            else if (stamp.registered)
+            {
+                trigger_volumes.Remove(object);
+                stamp.registered = false;
+            }
+            stamp.transform_version = object->GetTransformVersion();
+        }
+    }
+
+    TriggerVolumes& GameObjectManager::GetTriggerVolumes()
+    {
+        SyncTriggerVolumes();
+        return trigger_volumes;
+    }
+
+    const Physics::SegmentGrid& GameObjectManager::GetTerrainSegments()
+    {
+        std::vector<Physics::LineSegment> segments;
+        if (!terrain_enabled)
+        {
+            // Level still loading and pieces may still move: build from scratch every time
+            for (GameObject* object : type_buckets[BucketIndex(GameObjectTypes::Floor)])
+            {
+                if (slots[object->handle.index].terrain)
+                {
+                    const auto& walls = static_cast<MapElement*>(object)->GetWallSegments();
+                    segments.insert(segments.end(), walls.begin(), walls.end());
+                }
+            }
+            terrain_segments.Build(std::move(segments));
+            return terrain_segments;
+        }
+
+        if (terrain_dirty)
+        {
+            RebuildTerrain();
+        }
+        if (terrain_segments_dirty)
+        {
+            for (MapElement* element : terrain)
+            {
+                const auto& walls = element->GetWallSegments();
+                segments.insert(segments.end(), walls.begin(), walls.end());
+            }
+            terrain_segments.Build(std::move(segments));
+            terrain_segments_dirty = false;
+        }
+        return terrain_segments;
+    }
+
+    const std::vector<Physics::LineSegment>& GameObjectManager::GetDynamicLaserSegments()
+    {
+        constexpr std::array occluder_types = { GameObjectTypes::Mirror, GameObjectTypes::PushableMirror, GameObjectTypes::Gate };
+
+        // Compare handles and transform versions only; segments are rebuilt when any of them changed
+        size_t count = 0;
+        for (GameObjectTypes type : occluder_types)
+        {
+            for (GameObject* object : type_buckets[BucketIndex(type)])
+            {
+                const OccluderStamp stamp{ object->handle, object->GetTransformVersion() };
+                if (count >= laser_occluder_stamps.size())
+                {
+                    laser_occluder_stamps.push_back(stamp);
+                    laser_segments_dirty = true;
+                }
+                else if (!(laser_occluder_stamps[count].handle == stamp.handle) || laser_occluder_stamps[count].transform_version != stamp.transform_version)
+                {
+                    laser_occluder_stamps[count] = stamp;
+                    laser_segments_dirty         = true;
+                }
+                ++count;
+            }
+        }
+        if (count != laser_occluder_stamps.size())
+        {
+            laser_occluder_stamps.resize(count);
+            laser_segments_dirty = true;
+        }
+
+        if (laser_segments_dirty)
+        {
+            previous_laser_segments.swap(laser_segments);
+            laser_segments.clear();
+            for (GameObjectTypes type : occluder_types)
+            {
+                for (GameObject* object : type_buckets[BucketIndex(type)])
+                {
+                    object->AppendLaserSegments(laser_segments);
+                }
+            }
+            laser_segments_dirty = false;
+
+            // A transform change that left the segments where they were (a mirror re-setting its position) is not a new epoch
+            const bool unchanged = laser_segments.size() == previous_laser_segments.size() &&
+                                   std::equal(laser_segments.begin(), laser_segments.end(), previous_laser_segments.begin(), SameSegment);
+            if (!unchanged)
+            {
+                ++laser_occluder_epoch;
+                std::vector<Physics::LineSegment>& changes = laser_occluder_history[laser_occluder_epoch % laser_history_epochs];
+                changes.clear();
+                AppendMissing(previous_laser_segments, laser_segments, changes);
+                AppendMissing(laser_segments, previous_laser_segments, changes);
+            }
+        }
+        return laser_segments;
+    }
+
+    bool GameObjectManager::CollectLaserOccluderChanges(uint64_t since_epoch, std::vector<Physics::LineSegment>& out) const
+    {
+        if (since_epoch > laser_occluder_epoch || laser_occluder_epoch - since_epoch > laser_history_epochs)
+        {
+            return false;
+        }
+        for (uint64_t epoch = since_epoch + 1; epoch <= laser_occluder_epoch; ++epoch)
+        {
+            const auto& changes = laser_occluder_history[epoch % laser_history_epochs];
+            out.insert(out.end(), changes.begin(), changes.end());
+        }
+        return true;
+    }
+
+    void GameObjectManager::GatherCandidates(const Math::rect& bounds, uint32_t mask)
+    {
+        broad_phase_candidates.clear();
+        broad_phase.Query(bounds, broad_phase_candidates, mask);
+
+        if (!terrain_enabled || (mask & TypeBit(GameObjectTypes::Floor)) == 0)
+        {
+            return;
+        }
+
+        terrain_candidates.clear();
+        QueryTerrain(bounds, terrain_candidates);
+
+        const size_t dynamic_count = broad_phase_candidates.size();
+        for (MapElement* element : terrain_candidates)
+        {
+            if (element->GetGOComponent<Collision>() != nullptr)
+            {
+                broad_phase_candidates.push_back(element);
+            }
+        }
+
+        // Both halves are already in insertion order; merge so resolution order matches the objects list
+        auto earlier = [this](GameObject* a, GameObject* b) { return slots[a->handle.index].sequence < slots[b->handle.index].sequence; };
+        std::inplace_merge(broad_phase_candidates.begin(), broad_phase_candidates.begin() + static_cast<std::ptrdiff_t>(dynamic_count), broad_phase_candidates.end(), earlier);
+    }
+
     void GameObjectManager::CollisionTest()
     {
-        for (GameObject* object_1 : objects)
+        SyncBroadPhase();
+        if (terrain_dirty)
         {
-            if (!object_1->IsActive())
+            RebuildTerrain();
+        }
+
+        collision_stats                   = {};
+        collision_stats.colliders         = static_cast<int>(broad_phase.ObjectCount());
+        collision_stats.brute_force_pairs = static_cast<long long>(collision_stats.colliders) * (collision_stats.colliders - 1);
+        collision_stats.occupied_cells    = broad_phase.CellCount();
+        collision_stats.terrain_elements  = terrain_bvh.ItemCount();
+        collision_stats.terrain_nodes     = terrain_bvh.NodeCount();
+
+        // Indexed because resolution can spawn objects (particles); new objects join the broad phase next frame
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            GameObject* object_1 = objects[i];
+            if (!object_1->IsActive() || !broad_phase.Contains(object_1))
             {
                 continue;
             }
 
-            for (GameObject* object_2 : objects)
+            // Static types (floors, walls) never start a test, so static-vs-static pairs are never generated
+            const uint32_t mask = collision_matrix.Row(object_1->Type());
+            if (mask == 0)
             {
-                if (!object_2->IsActive())
+                ++collision_stats.passive_colliders;
+                continue;
+            }
+
+            Collision* collider = object_1->GetGOComponent<Collision>();
+
+            // Only objects sharing a grid cell (or terrain BVH leaf) with object_1 and on a layer it listens to can reach the narrow phase
+            GatherCandidates(collider->WorldBoundingBox(), mask);
+
+            bool resolved_any = false;
+            for (GameObject* object_2 : broad_phase_candidates)
+            {
+                if (object_1 == object_2 || !object_2->IsActive())
                 {
                     continue;
                 }
 
-                if ((object_1 != object_2) && (object_1->CanCollideWith(object_2->Type())))
+                ++collision_stats.candidate_pairs;
+
+                if (object_1->CanCollideWith(object_2->Type()))
                 {
+                    ++collision_stats.pairs_tested;
                     if (object_1->IsCollidingWith(object_2))
                     {
+                        ++collision_stats.pairs_colliding;
                         object_1->ResolveCollision(object_2);
+                        resolved_any = true;
                     }
                 }
             }
+
+            // Resolution may have pushed object_1 into other cells; keep its proxy current for later queries
+            if (resolved_any)
+            {
+                broad_phase.Move(object_1, collider->WorldBoundingBox());
+            }
         }
     }
 
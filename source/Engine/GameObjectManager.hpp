@@ -7,9 +7,17 @@
  */
 
 #pragma once
+#include "CollisionLayers.hpp"
 #include "GameObject.hpp"
+#include "GameObjectTypes.hpp"
 #include "Matrix.hpp"
-#include <list>
+#include "Physics/SegmentGrid.hpp"
+#include "SpatialHash.hpp"
+#include "StaticBVH.hpp"
+#include "TriggerVolumes.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
 
 namespace Math
 {
@@ -18,23 +26,199 @@ namespace Math
 
 namespace CS230
 {
+    class MapElement;
+
     class GameObjectManager : public CS230::Component
     {
     public:
-        void Add(GameObject* object);
-        void Unload();
+        // Per-frame numbers from the last CollisionTest, used to compare against the brute-force cost
+        struct CollisionStats
+        {
+            int         colliders         = 0;
+            int         passive_colliders = 0;
+            long long   brute_force_pairs = 0;
+            long long   candidate_pairs   = 0;
+            long long   pairs_tested      = 0;
+            long long   pairs_colliding   = 0;
+            size_t      occupied_cells    = 0;
+            size_t      terrain_elements  = 0;
+            size_t      terrain_nodes     = 0;
+        };
+
+        // Takes ownership. The returned handle stays safe to resolve after the object is deleted.
+        GameObjectHandle Add(GameObject* object);
+        void             Unload();
+
+        // nullptr once the object has been destroyed or the manager unloaded
+        GameObject* Get(GameObjectHandle handle) const;
+
+        template <typename T>
+        T* Get(GameObjectHandle handle) const
+        {
+            return static_cast<T*>(Get(handle));
+        }
 
         void UpdateAll(double dt);
         void DrawAll(Math::TransformationMatrix camera_matrix);
         void CollisionTest();
         void DrawAllImGui();
 
-        const std::list<GameObject*>& GetObjects() const
+        // Dense and in insertion order. Do not Add while iterating this directly.
+        const std::vector<GameObject*>& GetObjects() const
         {
             return objects;
         }
 
+        // Objects of one type in the order they were added. Do not Add while iterating this directly.
+        const std::vector<GameObject*>& GetObjectsOfType(GameObjectTypes type) const
+        {
+            return type_buckets[BucketIndex(type)];
+        }
+
+        // Calls func with every object of the given type cast to T*.
+        // Iterates by index so objects added from inside func are visited too, as in UpdateAll.
+        template <typename T, typename Func>
+        void ForEach(GameObjectTypes type, Func&& func) const
+        {
+            const std::vector<GameObject*>& bucket = type_buckets[BucketIndex(type)];
+            for (size_t i = 0; i < bucket.size(); ++i)
+            {
+                func(static_cast<T*>(bucket[i]));
+            }
+        }
+
+        const CollisionStats& GetCollisionStats() const
+        {
+            return collision_stats;
+        }
+
+        const CollisionMatrix& GetCollisionMatrix() const
+        {
+            return collision_matrix;
+        }
+
+        // Moves every MapElement out of the per-frame spatial hash into a BVH that is built once.
+        // Call when the level has finished loading; terrain added or destroyed later triggers a rebuild.
+        void BuildTerrain();
+
+        // Appends every MapElement whose world bounds overlap bounds, in the order they were added.
+        // Inactive elements are included; callers filter if they care.
+        void QueryTerrain(const Math::rect& bounds, std::vector<MapElement*>& out);
+
+        // Appends the active objects of type whose bounds may come within radius of the segment a-b, in the order
+        // they were added. Bounds are the Collision box, or GetQueryRadius around the position for objects without one.
+        // Only candidates: callers still run their exact test. Positions are refreshed at the start and end of UpdateAll,
+        // so a query from inside an Update sees objects where they were when the update began.
+        void QueryCapsule(Math::vec2 a, Math::vec2 b, double radius, GameObjectTypes type, std::vector<GameObject*>& out);
+
+        // Volumes of every active object with GetTriggerBounds, indexed by type with TriggerVolumes::Layer.
+        // Re-synced once per update pass for objects that moved, so queries from an Update see the previous frame's bounds.
+        TriggerVolumes& GetTriggerVolumes();
+
+        // Wall segments of every MapElement in a grid for laser ray casts, rebuilt only when the terrain changes
+        const Physics::SegmentGrid& GetTerrainSegments();
+
+        // AppendLaserSegments of every mirror, pushable mirror and gate, gathered again only when
+        // one of them moves, appears or disappears, or after InvalidateLaserOccluders
+        const std::vector<Physics::LineSegment>& GetDynamicLaserSegments();
+
+        // For occluder changes that do not move the object (a gate opening or closing)
+        void InvalidateLaserOccluders()
+        {
+            laser_segments_dirty = true;
+        }
+
+        // Bumped each time GetDynamicLaserSegments gathers segments that differ from the previous set
+        uint64_t GetLaserOccluderEpoch() const
+        {
+            return laser_occluder_epoch;
+        }
+
+        // Appends every occluder segment that appeared or disappeared after since_epoch (old and new
+        // positions of a moved mirror, a gate that opened). False when that history is no longer kept.
+        bool CollectLaserOccluderChanges(uint64_t since_epoch, std::vector<Physics::LineSegment>& out) const;
+
     private:
-        std::list<GameObject*> objects;
+        void SyncBroadPhase();
+        void ReleaseSlot(GameObject* object);
+        void RebuildTerrain();
+        void GatherCandidates(const Math::rect& bounds, uint32_t mask);
+        void SyncQueryIndex(GameObjectTypes type);
+        void SyncTriggerVolumes();
+
+        struct Slot
+        {
+            GameObject* object     = nullptr;
+            uint32_t    generation = 0;
+            // Insertion sequence; orders broad phase results the same way as the objects list
+            uint64_t sequence = 0;
+            // Set for MapElements, which move into the terrain BVH once BuildTerrain is called
+            bool terrain = false;
+        };
+
+        struct OccluderStamp
+        {
+            GameObjectHandle handle;
+            uint32_t         transform_version = 0;
+        };
+
+        struct TriggerStamp
+        {
+            GameObjectHandle handle;
+            uint32_t         transform_version = 0;
+            bool             registered        = false;
+        };
+
+        static size_t BucketIndex(GameObjectTypes type)
+        {
+            return static_cast<size_t>(type);
+        }
+
+        static uint32_t TypeBit(GameObjectTypes type)
+        {
+            return uint32_t{ 1 } << static_cast<uint32_t>(type);
+        }
+
+        std::vector<GameObject*>                                  objects;
+        std::array<std::vector<GameObject*>, GameObjectTypeSlots> type_buckets;
+
+        std::vector<Slot>        slots;
+        std::vector<uint32_t>    free_slots;
+        std::vector<GameObject*> destroy_objects;
+        uint64_t                 next_sequence = 0;
+
+        SpatialHash              broad_phase;
+        std::vector<GameObject*> broad_phase_candidates;
+        CollisionMatrix          collision_matrix;
+        CollisionStats           collision_stats;
+
+        // Objects of the types QueryCapsule has been asked about; a type is re-synced once per update pass
+        SpatialHash                               query_index;
+        std::array<uint64_t, GameObjectTypeSlots> query_synced_pass{};
+        uint64_t                                  update_pass = 1;
+
+        // Objects that reported trigger bounds when added, with the transform their volume was last read at
+        TriggerVolumes            trigger_volumes;
+        std::vector<TriggerStamp> trigger_stamps;
+        uint64_t                  trigger_synced_pass = 0;
+
+        StaticBVH                terrain_bvh;
+        std::vector<MapElement*> terrain;
+        std::vector<uint32_t>    terrain_query_ids;
+        std::vector<MapElement*> terrain_candidates;
+        Physics::SegmentGrid     terrain_segments;
+        bool                     terrain_enabled        = false;
+        bool                     terrain_dirty          = false;
+        bool                     terrain_segments_dirty = false;
+
+        static constexpr size_t laser_history_epochs = 4;
+
+        std::vector<Physics::LineSegment> laser_segments;
+        std::vector<Physics::LineSegment> previous_laser_segments;
+        std::vector<OccluderStamp>        laser_occluder_stamps;
+        bool                              laser_segments_dirty = true;
+        uint64_t                          laser_occluder_epoch = 0;
+        // Entry epoch % laser_history_epochs holds what changed going into that epoch
+        std::array<std::vector<Physics::LineSegment>, laser_history_epochs> laser_occluder_history;
     };
-}
\ No newline at end of file
+}
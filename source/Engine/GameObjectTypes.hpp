@@ -6,6 +6,7 @@
  * \copyright DigiPen Institute of Technology
  */
 #pragma once
+#include <cstddef>
 
 enum class GameObjectTypes
 {
@@ -34,4 +35,7 @@ enum class GameObjectTypes
     Count,
     Background,
     Pillar
-};
\ No newline at end of file
+};
+
+// Background and Pillar come after Count, so per-type tables are sized by the last enumerator
+constexpr size_t GameObjectTypeSlots = static_cast<size_t>(GameObjectTypes::Pillar) + 1;
@@ -10,6 +10,7 @@
 
 #include "Input.hpp"
 #include "Engine.hpp"
+#include "InputRecording.hpp"
 #include "Logger.hpp"
 #include <SDL.h>
 
@@ -100,6 +101,53 @@ namespace CS230
         SetMouseButtonDown(MouseButton::Right, (mouse_state & SDL_BUTTON(SDL_BUTTON_RIGHT)) != 0);
     }
 
+    void Input::ConsumeTransitions()
+    {
+        previous_keys_down          = keys_down;
+        previous_mouse_buttons_down = mouse_buttons_down;
+    }
+
+    InputFrame Input::Capture() const
+    {
+        InputFrame frame;
+        for (size_t i = 0; i < keys_down.size(); ++i)
+        {
+            if (keys_down[i])
+            {
+                frame.keys |= uint64_t{ 1 } << i;
+            }
+        }
+        for (size_t i = 0; i < mouse_buttons_down.size(); ++i)
+        {
+            if (mouse_buttons_down[i])
+            {
+                frame.mouse_buttons = static_cast<uint8_t>(frame.mouse_buttons | (1u << i));
+            }
+        }
+        frame.mouse_x = static_cast<float>(mouse_position.x);
+        frame.mouse_y = static_cast<float>(mouse_position.y);
+        return frame;
+    }
+
+    void Input::UpdateFromFrame(const InputFrame& frame)
+    {
+        static_assert(static_cast<size_t>(Keys::Count) <= 64, "InputFrame stores keys in a 64-bit mask");
+        static_assert(static_cast<size_t>(MouseButton::Count) <= 8, "InputFrame stores mouse buttons in an 8-bit mask");
+
+        previous_keys_down          = keys_down;
+        previous_mouse_buttons_down = mouse_buttons_down;
+
+        for (size_t i = 0; i < keys_down.size(); ++i)
+        {
+            keys_down[i] = ((frame.keys >> i) & 1u) != 0;
+        }
+        for (size_t i = 0; i < mouse_buttons_down.size(); ++i)
+        {
+            mouse_buttons_down[i] = ((frame.mouse_buttons >> i) & 1u) != 0;
+        }
+        mouse_position = { static_cast<double>(frame.mouse_x), static_cast<double>(frame.mouse_y) };
+    }
+
     // KeyBoard
     bool Input::KeyDown(Keys key) const
     {
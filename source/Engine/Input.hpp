@@ -15,6 +15,8 @@
 
 namespace CS230
 {
+    struct InputFrame;
+
     class Input
     {
     public:
@@ -68,6 +70,12 @@ namespace CS230
 
         Input();
         void Update();
+        // Makes the JustPressed/JustReleased queries report false until the next Update
+        void ConsumeTransitions();
+
+        // Recording/replay: the held state the last Update sampled, and an Update that reads it back instead of SDL
+        InputFrame Capture() const;
+        void       UpdateFromFrame(const InputFrame& frame);
 
         bool KeyDown(Keys key) const;
         bool KeyJustReleased(Keys key) const;
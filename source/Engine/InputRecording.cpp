@@ -0,0 +1,116 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "InputRecording.hpp"
+#include <array>
+
+namespace
+{
+    constexpr std::array<char, 4> magic   = { 'O', 'L', 'I', 'R' };
+    constexpr uint32_t            version = 1;
+
+    template <typename T>
+    void WriteValue(std::ofstream& file, const T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool ReadValue(std::ifstream& file, T& value)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+namespace CS230
+{
+    bool InputRecorder::Open(const std::filesystem::path& file_path, uint64_t seed)
+    {
+        Close();
+        file.open(file_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(magic.data(), magic.size());
+        WriteValue(file, version);
+        WriteValue(file, seed);
+        frame_count = 0;
+        return true;
+    }
+
+    void InputRecorder::Write(const InputFrame& frame)
+    {
+        if (!file.is_open())
+        {
+            return;
+        }
+
+        WriteValue(file, frame.delta_time);
+        WriteValue(file, frame.keys);
+        WriteValue(file, frame.mouse_buttons);
+        WriteValue(file, frame.mouse_x);
+        WriteValue(file, frame.mouse_y);
+        ++frame_count;
+    }
+
+    void InputRecorder::Close()
+    {
+        if (file.is_open())
+        {
+            file.close();
+        }
+    }
+
+    bool InputReplayer::Open(const std::filesystem::path& file_path)
+    {
+        Close();
+        file.open(file_path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::array<char, 4> file_magic{};
+        uint32_t            file_version = 0;
+        if (!file.read(file_magic.data(), file_magic.size()) || file_magic != magic || !ReadValue(file, file_version) || file_version != version || !ReadValue(file, seed))
+        {
+            Close();
+            return false;
+        }
+
+        frame_count = 0;
+        return true;
+    }
+
+    bool InputReplayer::Read(InputFrame& frame)
+    {
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        InputFrame next;
+        if (!ReadValue(file, next.delta_time) || !ReadValue(file, next.keys) || !ReadValue(file, next.mouse_buttons) || !ReadValue(file, next.mouse_x) || !ReadValue(file, next.mouse_y))
+        {
+            return false;
+        }
+
+        frame = next;
+        ++frame_count;
+        return true;
+    }
+
+    void InputReplayer::Close()
+    {
+        if (file.is_open())
+        {
+            file.close();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace CS230
+{
+    // Everything Input::Update reads from SDL in one frame, plus that frame's dt
+    struct InputFrame
+    {
+        double   delta_time    = 0.0;
+        uint64_t keys          = 0; // bit i set while Input::Keys(i) is held
+        uint8_t  mouse_buttons = 0; // bit i set while Input::MouseButton(i) is held
+        float    mouse_x       = 0.0f;
+        float    mouse_y       = 0.0f;
+    };
+
+    // Binary layout (host byte order):
+    //   header: "OLIR" | uint32 version | uint64 random seed
+    //   frames: double dt | uint64 keys | uint8 mouse buttons | float mouse x | float mouse y
+    class InputRecorder
+    {
+    public:
+        bool Open(const std::filesystem::path& file_path, uint64_t seed);
+        void Write(const InputFrame& frame);
+        void Close();
+
+        bool IsOpen() const
+        {
+            return file.is_open();
+        }
+
+        uint64_t FrameCount() const
+        {
+            return frame_count;
+        }
+
+    private:
+        std::ofstream file;
+        uint64_t      frame_count = 0;
+    };
+
+    class InputReplayer
+    {
+    public:
+        // False if the file is missing or was written by a different format version
+        bool Open(const std::filesystem::path& file_path);
+        // False once every recorded frame has been handed out
+        bool Read(InputFrame& frame);
+        void Close();
+
+        bool IsOpen() const
+        {
+            return file.is_open();
+        }
+
+        uint64_t GetSeed() const
+        {
+            return seed;
+        }
+
+        uint64_t FrameCount() const
+        {
+            return frame_count;
+        }
+
+    private:
+        std::ifstream file;
+        uint64_t      seed        = 0;
+        uint64_t      frame_count = 0;
+    };
+}
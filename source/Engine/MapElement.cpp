@@ -3,6 +3,7 @@
 #include "CS200/RGBA.hpp"
 #include "Engine/Collision.hpp"
 #include "Engine/Engine.hpp"
+#include <algorithm>
 
 namespace CS230
 {
@@ -13,7 +14,11 @@ namespace CS230
 
         if (type == GameObjectTypes::Floor)
         {
-            AddGOComponent(new SATCollision(local_polygon, this));
+            SATCollision* collision = new SATCollision(local_polygon, this);
+            AddGOComponent(collision);
+
+            // Classify the terrain edges at load instead of on the first frame the player touches this floor
+            collision->WorldEdges();
         }
     }
     // MapElement::MapElement(Math::vec2 pos, Polygon polygon) : CS230::GameObject(pos), local_polygon(std::move(polygon))
@@ -68,10 +73,18 @@ namespace CS230
         CS230::GameObject::Draw(camera_matrix);
     }
 
-    std::vector<Physics::LineSegment> CS230::MapElement::GetWallSegments()
+    const std::vector<Physics::LineSegment>& CS230::MapElement::GetWallSegments()
     {
-        std::vector<Physics::LineSegment> segments;
-        Math::TransformationMatrix        mat = GetMatrix();
+        if (has_wall_segments && wall_segments_version == GetTransformVersion())
+        {
+            return wall_segments;
+        }
+
+        wall_segments.clear();
+        wall_segments_version = GetTransformVersion();
+        has_wall_segments     = true;
+
+        const Math::TransformationMatrix& mat = GetMatrix();
 
         const auto& verts = local_polygon.vertices;
 
@@ -82,8 +95,26 @@ namespace CS230
             Math::vec2 p2 = mat * verts[(i + 1) % verts.size()];
 
             // The 'false' flag indicates that standard map geometry absorbs lasers instead of reflecting them
-            segments.push_back({ p1, p2, false });
+            wall_segments.push_back({ p1, p2, false });
+        }
+        return wall_segments;
+    }
+
+    Math::rect MapElement::GetWorldBounds()
+    {
+        const std::vector<Physics::LineSegment>& segments = GetWallSegments();
+        if (segments.empty())
+        {
+            return { GetPosition(), GetPosition() };
+        }
+
+        Math::vec2 min = segments[0].p1;
+        Math::vec2 max = min;
+        for (const Physics::LineSegment& segment : segments)
+        {
+            min = { std::min(min.x, segment.p1.x), std::min(min.y, segment.p1.y) };
+            max = { std::max(max.x, segment.p1.x), std::max(max.y, segment.p1.y) };
         }
-        return segments;
+        return { min, max };
     }
-}
\ No newline at end of file
+}
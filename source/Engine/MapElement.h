@@ -3,6 +3,7 @@
 #include "Engine/GameObjectTypes.hpp"
 #include "Engine/Physics/Reflection.hpp"
 #include "Engine/Polygon.h"
+#include "Engine/Rect.hpp"
 #include "Engine/Vec2.hpp"
 #include <vector>
 
@@ -17,8 +18,11 @@ namespace CS230
         // MapElement(Math::vec2 pos, Polygon polygon);
         void Draw(const Math::TransformationMatrix& camera_matrix) override;
 
-        // Retrieves the world-space boundaries of the polygon for laser/physics intersections
-        std::vector<Physics::LineSegment> GetWallSegments();
+        // Retrieves the world-space boundaries of the polygon for laser/physics intersections.
+        // Cached until the element is moved, so static terrain is transformed once.
+        const std::vector<Physics::LineSegment>& GetWallSegments();
+        // Axis-aligned box around GetWallSegments
+        Math::rect GetWorldBounds();
 
         GameObjectTypes Type() override
         {
@@ -34,5 +38,9 @@ namespace CS230
         // The base shape of the terrain element in local coordinates
         Polygon         local_polygon;
         GameObjectTypes in_type;
+
+        std::vector<Physics::LineSegment> wall_segments;
+        uint32_t                          wall_segments_version = 0;
+        bool                              has_wall_segments     = false;
     };
 }
\ No newline at end of file
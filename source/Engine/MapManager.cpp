@@ -25,6 +25,7 @@ namespace CS230
     {
         if (maps.empty())
             return;
+        terrainBuilt = false;
         maps[static_cast<size_t>(currentMapIndex)]->OpenSVG();
     }
 
@@ -36,6 +37,8 @@ namespace CS230
         }
         maps.clear();
         miniMapPolygons.clear();
+        miniMapTree.Clear();
+        terrainBuilt = false;
     }
 
     Map* MapManager::GetCurrentMap()
@@ -86,6 +89,43 @@ namespace CS230
         {
             currentMap->ParseSVG();
         }
+
+        if (currentMap && currentMap->IsLevelLoaded() && !terrainBuilt)
+        {
+            BuildTerrain();
+        }
+    }
+
+    void MapManager::QueryMiniMapPolygons(const Math::rect& view, std::vector<uint32_t>& out) const
+    {
+        if (!terrainBuilt)
+        {
+            for (size_t i = 0; i < miniMapPolygons.size(); ++i)
+            {
+                out.push_back(static_cast<uint32_t>(i));
+            }
+            return;
+        }
+        miniMapTree.Query(view, out);
+    }
+
+    void MapManager::BuildTerrain()
+    {
+        terrainBuilt = true;
+
+        std::vector<StaticBVH::Item> items;
+        items.reserve(miniMapPolygons.size());
+        for (size_t i = 0; i < miniMapPolygons.size(); ++i)
+        {
+            items.push_back({ miniMapPolygons[i].FindBoundary(), static_cast<uint32_t>(i) });
+        }
+        miniMapTree.Build(std::move(items));
+
+        GameObjectManager* gom = Engine::GetGameStateManager().GetGSComponent<GameObjectManager>();
+        if (gom != nullptr)
+        {
+            gom->BuildTerrain();
+        }
     }
 
     Map::Map(const std::string& filename)
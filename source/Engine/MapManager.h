@@ -4,6 +4,7 @@
 #include "Engine/GameObjectTypes.hpp"
 #include "Engine/Polygon.h"
 #include "Engine/Rect.hpp"
+#include "Engine/StaticBVH.hpp"
 #include "Engine/Vec2.hpp"
 
 #include <fstream>
@@ -63,8 +64,13 @@ namespace CS230
         void AddPolygon(const Polygon& poly)
         {
             miniMapPolygons.push_back(poly);
+            terrainBuilt = false;
         }
 
+        // Appends the indices (into GetMiniMapPolygons) of polygons overlapping view, in ascending order.
+        // Returns every polygon while the level is still loading.
+        void QueryMiniMapPolygons(const Math::rect& view, std::vector<uint32_t>& out) const;
+
         // Returns the room that contains playerPos, or nullopt if none
         std::optional<Math::rect> GetCurrentRoom(Math::vec2 playerPos) const;
 
@@ -75,9 +81,14 @@ namespace CS230
         int GetCurrentRoomIndex(Math::vec2 playerPos) const;
 
     private:
+        // Runs once per loaded level: moves terrain into the GameObjectManager BVH and indexes the minimap polygons
+        void BuildTerrain();
+
         std::vector<Map*>    maps;
         int                  currentMapIndex;
         std::vector<Polygon> miniMapPolygons; // Aggregated geometry for UI rendering
+        StaticBVH            miniMapTree;
+        bool                 terrainBuilt = false;
 
         GameObjectFactory objectFactory = nullptr;
     };
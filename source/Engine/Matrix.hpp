@@ -10,13 +10,19 @@
 
 #pragma once
 #include "Vec2.hpp"
+#include <cmath>
 
 namespace Math
 {
+    // General 3x3 matrix, row-major. Inline so composing the translation/rotation/scale chain that every
+    // object and draw call builds does not cost a call per product; see Affine.hpp for the 2x3 fast path.
     class TransformationMatrix
     {
     public:
-        TransformationMatrix();
+        constexpr TransformationMatrix()
+        {
+            Reset();
+        }
 
         constexpr double* operator[](int index)
         {
@@ -28,32 +34,97 @@ namespace Math
             return matrix[index];
         }
 
-        TransformationMatrix  operator*(TransformationMatrix m) const;
-        TransformationMatrix& operator*=(TransformationMatrix m);
-        vec2                  operator*(vec2 v) const;
-        void                  Reset();
+        constexpr TransformationMatrix operator*(const TransformationMatrix& m) const
+        {
+            TransformationMatrix result;
+
+            result.matrix[0][0] = matrix[0][0] * m[0][0] + matrix[0][1] * m[1][0] + matrix[0][2] * m[2][0];
+            result.matrix[0][1] = matrix[0][0] * m[0][1] + matrix[0][1] * m[1][1] + matrix[0][2] * m[2][1];
+            result.matrix[0][2] = matrix[0][0] * m[0][2] + matrix[0][1] * m[1][2] + matrix[0][2] * m[2][2];
+            result.matrix[1][0] = matrix[1][0] * m[0][0] + matrix[1][1] * m[1][0] + matrix[1][2] * m[2][0];
+            result.matrix[1][1] = matrix[1][0] * m[0][1] + matrix[1][1] * m[1][1] + matrix[1][2] * m[2][1];
+            result.matrix[1][2] = matrix[1][0] * m[0][2] + matrix[1][1] * m[1][2] + matrix[1][2] * m[2][2];
+            result.matrix[2][0] = matrix[2][0] * m[0][0] + matrix[2][1] * m[1][0] + matrix[2][2] * m[2][0];
+            result.matrix[2][1] = matrix[2][0] * m[0][1] + matrix[2][1] * m[1][1] + matrix[2][2] * m[2][1];
+            result.matrix[2][2] = matrix[2][0] * m[0][2] + matrix[2][1] * m[1][2] + matrix[2][2] * m[2][2];
+
+            return result;
+        }
+
+        constexpr TransformationMatrix& operator*=(const TransformationMatrix& m)
+        {
+            (*this) = (*this) * m;
+            return (*this);
+        }
+
+        constexpr vec2 operator*(vec2 v) const
+        {
+            vec2 result;
+            result.x = matrix[0][0] * v.x + matrix[0][1] * v.y + matrix[0][2];
+            result.y = matrix[1][0] * v.x + matrix[1][1] * v.y + matrix[1][2];
+            return result;
+        }
+
+        constexpr void Reset()
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    matrix[i][j] = 0.0;
+                }
+            }
+
+            matrix[0][0] = 1.0;
+            matrix[1][1] = 1.0;
+            matrix[2][2] = 1.0;
+        }
 
     protected:
-        double matrix[3][3];
+        double matrix[3][3]{};
     };
 
     class TranslationMatrix : public TransformationMatrix
     {
     public:
-        TranslationMatrix(ivec2 translate);
-        TranslationMatrix(vec2 translate);
+        constexpr TranslationMatrix(ivec2 translate)
+        {
+            matrix[0][2] = static_cast<double>(translate.x);
+            matrix[1][2] = static_cast<double>(translate.y);
+        }
+
+        constexpr TranslationMatrix(vec2 translate)
+        {
+            matrix[0][2] = translate.x;
+            matrix[1][2] = translate.y;
+        }
     };
 
     class RotationMatrix : public TransformationMatrix
     {
     public:
-        RotationMatrix(double theta);
+        RotationMatrix(double theta)
+        {
+            matrix[0][0] = std::cos(theta);
+            matrix[0][1] = -std::sin(theta);
+            matrix[1][0] = std::sin(theta);
+            matrix[1][1] = std::cos(theta);
+        }
     };
 
     class ScaleMatrix : public TransformationMatrix
     {
     public:
-        ScaleMatrix(double scale);
-        ScaleMatrix(vec2 scale);
+        constexpr ScaleMatrix(double scale)
+        {
+            matrix[0][0] = scale;
+            matrix[1][1] = scale;
+        }
+
+        constexpr ScaleMatrix(vec2 scale)
+        {
+            matrix[0][0] = scale.x;
+            matrix[1][1] = scale.y;
+        }
     };
 }
\ No newline at end of file
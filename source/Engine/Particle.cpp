@@ -5,7 +5,7 @@ CS230::Particle::Particle(const std::filesystem::path& sprite_file) : GameObject
 }
 
 void CS230::Particle::Start(Math::vec2 pos, Math::vec2 vel, double max_life) {
-    SetPosition(pos);
+    Teleport(pos);
     SetVelocity(vel);
     life = max_life;
 
@@ -1,5 +1,7 @@
 #include "Reflection.hpp"
 #include "Engine/Vec2.hpp"
+#include "SegmentGrid.hpp"
+#include "SegmentSoA.hpp"
 #include <cmath>
 #include <limits>
 
@@ -10,6 +12,93 @@ namespace
     {
         return Math::vec2{ -v.y, v.x };
     }
+
+    // Closest segment hit by the ray from any of the provided sources
+    struct LaserHit
+    {
+        double                      t = std::numeric_limits<double>::infinity();
+        Math::vec2                  point{};
+        const Physics::LineSegment* segment = nullptr;
+    };
+
+    // Copies the segments into the calling thread's scratch store so each bounce can use the batched kernel
+    const Physics::SegmentSoA& ToSoA(const std::vector<Physics::LineSegment>& segments)
+    {
+        thread_local Physics::SegmentSoA soa;
+        soa.Clear();
+        soa.Reserve(segments.size());
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            soa.Add(segments[i], static_cast<uint32_t>(i));
+        }
+        return soa;
+    }
+
+    void ClosestLinearHit(Math::vec2 pos, Math::vec2 dir, const std::vector<Physics::LineSegment>& segments, const Physics::SegmentSoA& soa, double minT, LaserHit& hit)
+    {
+        double t;
+        size_t entry;
+        if (soa.ClosestHit(pos, dir, 0, soa.Size(), minT, std::numeric_limits<double>::infinity(), t, entry) && t < hit.t)
+        {
+            hit = { t, pos + dir * t, &segments[soa.Id(entry)] };
+        }
+    }
+
+    // Bounce loop shared by both CalculateLaserPath overloads; findHit(pos, dir, minT, remaining, hit) fills the closest hit
+    template <typename FindHit>
+    std::vector<std::pair<Math::vec2, Math::vec2>> TraceLaserPath(Math::vec2 startPos, Math::vec2 initialDir, int maxBounces, double maxLength, FindHit&& findHit)
+    {
+        std::vector<std::pair<Math::vec2, Math::vec2>> path;
+
+        // Optimization: Reserve vector memory
+        path.reserve(static_cast<size_t>(maxBounces + 1));
+
+        Math::vec2   currentPos = startPos;
+        Math::vec2   currentDir = initialDir.Normalize();
+        const double epsilon    = 0.1;
+
+        double remainingLength = maxLength;
+
+        for (int bounce = 0; bounce <= maxBounces; ++bounce)
+        {
+            if (remainingLength <= 0.0) break;
+
+            LaserHit hit;
+            findHit(currentPos, currentDir, epsilon, remainingLength, hit);
+
+            if (hit.segment != nullptr && hit.t <= remainingLength)
+            {
+                path.emplace_back(currentPos, hit.point);
+
+                remainingLength -= hit.t;
+
+                if (hit.segment->isReflective)
+                {
+                    // Correct normal direction
+                    Math::vec2 surfaceNormal = perpendicular(hit.segment->p2 - hit.segment->p1).Normalize();
+                    if (dot(surfaceNormal, -currentDir) < 0)
+                        surfaceNormal = -surfaceNormal;
+
+                    // Apply reflection
+                    currentPos = hit.point + surfaceNormal * epsilon;
+                    currentDir = Physics::CalculateReflection(currentDir, surfaceNormal);
+                }
+                else
+                {
+                    // Stop if not reflective
+                    break;
+                }
+            }
+            else
+            {
+                // No hit
+                Math::vec2 endPoint = currentPos + currentDir * remainingLength;
+                path.push_back({ currentPos, endPoint });
+                break;
+            }
+        }
+        return path;
+    }
 }
 
 namespace Physics
@@ -57,76 +146,29 @@ namespace Physics
 
     std::vector<std::pair<Math::vec2, Math::vec2>> CalculateLaserPath(Math::vec2 startPos, Math::vec2 initialDir, const std::vector<LineSegment>& segments, int maxBounces, double maxLength)
     {
-        std::vector<std::pair<Math::vec2, Math::vec2>> path;
-
-        // Optimization: Reserve vector memory
-        path.reserve(static_cast<size_t>(maxBounces + 1));
-
-        Math::vec2   currentPos = startPos;
-        Math::vec2   currentDir = initialDir.Normalize();
-        const double epsilon    = 0.1;
-
-        double remainingLength = maxLength;
-
-        for (int bounce = 0; bounce <= maxBounces; ++bounce)
-        {
-            if (remainingLength <= 0.0) break;
-
-            double     closestT = std::numeric_limits<double>::infinity();
-            Math::vec2 closestIntersection;
-            Math::vec2 surfaceNormal;
-            int        intersectedIndex = -1;
-
-            // Check all segments
-            for (size_t i = 0; i < segments.size(); ++i)
-            {
-                Math::vec2 intersectionPoint;
-                double     t;
-                if (RaySegmentIntersection(currentPos, currentDir, segments[i].p1, segments[i].p2, intersectionPoint, t))
-                {
-                    if (t > epsilon && t < closestT)
-                    {
-                        closestT            = t;
-                        closestIntersection = intersectionPoint;
-                        intersectedIndex    = static_cast<int>(i);
-
-                        Math::vec2 segmentVec = segments[i].p2 - segments[i].p1;
-                        Math::vec2 normal     = perpendicular(segmentVec).Normalize();
-
-                        // Correct normal direction
-                        if (dot(normal, -currentDir) < 0)
-                            normal = -normal;
-                        surfaceNormal = normal;
-                    }
-                }
-            }
+        // Check all segments
+        const SegmentSoA& soa = ToSoA(segments);
+        return TraceLaserPath(
+            startPos, initialDir, maxBounces, maxLength,
+            [&segments, &soa](Math::vec2 pos, Math::vec2 dir, double minT, double, LaserHit& hit) { ClosestLinearHit(pos, dir, segments, soa, minT, hit); });
+    }
 
-            if (intersectedIndex != -1 && closestT <= remainingLength)
+    std::vector<std::pair<Math::vec2, Math::vec2>> CalculateLaserPath(
+        Math::vec2 startPos, Math::vec2 initialDir, const SegmentGrid& grid, const std::vector<LineSegment>& dynamicSegments, int maxBounces, double maxLength)
+    {
+        const SegmentSoA& soa = ToSoA(dynamicSegments);
+        return TraceLaserPath(
+            startPos, initialDir, maxBounces, maxLength,
+            [&grid, &dynamicSegments, &soa](Math::vec2 pos, Math::vec2 dir, double minT, double remaining, LaserHit& hit)
             {
-                path.emplace_back(currentPos, closestIntersection);
-                
-                remainingLength -= closestT;
+                ClosestLinearHit(pos, dir, dynamicSegments, soa, minT, hit);
 
-                if (segments[static_cast<size_t>(intersectedIndex)].isReflective)
+                // Only walk the grid up to the nearest dynamic hit (or the end of the beam)
+                SegmentGrid::Hit gridHit;
+                if (grid.Raycast(pos, dir, minT, std::min(hit.t, remaining), gridHit) && gridHit.t < hit.t)
                 {
-                    // Apply reflection
-                    currentPos = closestIntersection + surfaceNormal * epsilon;
-                    currentDir = CalculateReflection(currentDir, surfaceNormal);
-                }
-                else
-                {
-                    // Stop if not reflective
-                    break;
+                    hit = { gridHit.t, gridHit.point, &grid.GetSegments()[gridHit.index] };
                 }
-            }
-            else
-            {
-                // No hit
-                Math::vec2 endPoint = currentPos + currentDir * remainingLength;
-                path.push_back({ currentPos, endPoint });
-                break;
-            }
-        }
-        return path;
+            });
     }
 }
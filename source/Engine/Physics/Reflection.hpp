@@ -22,4 +22,11 @@ namespace Physics
     // Calculate multiple bounces of laser path
     std::vector<std::pair<Math::vec2, Math::vec2>>
         CalculateLaserPath(Math::vec2 startPos, Math::vec2 initialDir, const std::vector<LineSegment>& segments, int maxBounces = 5, double maxLength = 15000.0);
+
+    class SegmentGrid;
+
+    // Same path, but static segments come from a grid walked along each bounce.
+    // dynamicSegments (mirrors, gates, shields) are still tested linearly and win exact ties.
+    std::vector<std::pair<Math::vec2, Math::vec2>> CalculateLaserPath(
+        Math::vec2 startPos, Math::vec2 initialDir, const SegmentGrid& grid, const std::vector<LineSegment>& dynamicSegments, int maxBounces = 5, double maxLength = 15000.0);
 }
\ No newline at end of file
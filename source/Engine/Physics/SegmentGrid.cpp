@@ -0,0 +1,199 @@
+#include "SegmentGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    constexpr int    max_cells_per_axis = 512;
+    constexpr double min_cell_size      = 32.0;
+    // Boxes are grown slightly so segments lying on a cell border are found from both sides
+    constexpr double cell_padding = 1e-3;
+}
+
+namespace Physics
+{
+    void SegmentGrid::Build(std::vector<LineSegment> in_segments, double cell_size)
+    {
+        Clear();
+        segments = std::move(in_segments);
+        if (segments.empty())
+        {
+            return;
+        }
+
+        grid_min = segments[0].p1;
+        grid_max = grid_min;
+        for (const LineSegment& segment : segments)
+        {
+            grid_min = { std::min({ grid_min.x, segment.p1.x, segment.p2.x }), std::min({ grid_min.y, segment.p1.y, segment.p2.y }) };
+            grid_max = { std::max({ grid_max.x, segment.p1.x, segment.p2.x }), std::max({ grid_max.y, segment.p1.y, segment.p2.y }) };
+        }
+        grid_min -= Math::vec2{ cell_padding, cell_padding };
+        grid_max += Math::vec2{ cell_padding, cell_padding };
+
+        const double width  = grid_max.x - grid_min.x;
+        const double height = grid_max.y - grid_min.y;
+        if (cell_size <= 0.0)
+        {
+            // Roughly one segment per cell on average
+            cell_size = std::sqrt(width * height / static_cast<double>(segments.size()));
+        }
+        cell_size = std::max({ cell_size, min_cell_size, width / max_cells_per_axis, height / max_cells_per_axis });
+
+        cell    = cell_size;
+        columns = std::max(1, static_cast<int>(std::ceil(width / cell)));
+        rows    = std::max(1, static_cast<int>(std::ceil(height / cell)));
+
+        auto cell_range = [this](const LineSegment& segment, int& x0, int& y0, int& x1, int& y1)
+        {
+            x0 = std::clamp(static_cast<int>((std::min(segment.p1.x, segment.p2.x) - cell_padding - grid_min.x) / cell), 0, columns - 1);
+            y0 = std::clamp(static_cast<int>((std::min(segment.p1.y, segment.p2.y) - cell_padding - grid_min.y) / cell), 0, rows - 1);
+            x1 = std::clamp(static_cast<int>((std::max(segment.p1.x, segment.p2.x) + cell_padding - grid_min.x) / cell), 0, columns - 1);
+            y1 = std::clamp(static_cast<int>((std::max(segment.p1.y, segment.p2.y) + cell_padding - grid_min.y) / cell), 0, rows - 1);
+        };
+
+        // Two passes (count, then fill) so every cell's list is one contiguous run
+        cell_start.assign(CellCount() + 1, 0);
+        for (const LineSegment& segment : segments)
+        {
+            int x0, y0, x1, y1;
+            cell_range(segment, x0, y0, x1, y1);
+            for (int y = y0; y <= y1; ++y)
+            {
+                for (int x = x0; x <= x1; ++x)
+                {
+                    ++cell_start[static_cast<size_t>(CellIndex(x, y)) + 1];
+                }
+            }
+        }
+        for (size_t i = 1; i < cell_start.size(); ++i)
+        {
+            cell_start[i] += cell_start[i - 1];
+        }
+
+        std::vector<uint32_t> cell_items(cell_start.back());
+        std::vector<uint32_t> fill(cell_start.begin(), cell_start.end() - 1);
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            int x0, y0, x1, y1;
+            cell_range(segments[i], x0, y0, x1, y1);
+            for (int y = y0; y <= y1; ++y)
+            {
+                for (int x = x0; x <= x1; ++x)
+                {
+                    cell_items[fill[static_cast<size_t>(CellIndex(x, y))]++] = static_cast<uint32_t>(i);
+                }
+            }
+        }
+
+        cell_segments.Reserve(cell_items.size());
+        for (uint32_t index : cell_items)
+        {
+            cell_segments.Add(segments[index], index);
+        }
+    }
+
+    void SegmentGrid::Clear()
+    {
+        segments.clear();
+        cell_start.clear();
+        cell_segments.Clear();
+        columns = 0;
+        rows    = 0;
+        ++revision;
+    }
+
+    bool SegmentGrid::Raycast(Math::vec2 origin, Math::vec2 dir, double min_t, double max_t, Hit& hit) const
+    {
+        if (segments.empty())
+        {
+            return false;
+        }
+
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+
+        // Clip the ray to the grid box (slab test)
+        double t_enter = 0.0;
+        double t_exit  = max_t;
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            const double o  = axis == 0 ? origin.x : origin.y;
+            const double d  = axis == 0 ? dir.x : dir.y;
+            const double lo = axis == 0 ? grid_min.x : grid_min.y;
+            const double hi = axis == 0 ? grid_max.x : grid_max.y;
+            if (d == 0.0)
+            {
+                if (o < lo || o > hi)
+                {
+                    return false;
+                }
+                continue;
+            }
+            double t0 = (lo - o) / d;
+            double t1 = (hi - o) / d;
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+            }
+            t_enter = std::max(t_enter, t0);
+            t_exit  = std::min(t_exit, t1);
+        }
+        if (t_enter > t_exit)
+        {
+            return false;
+        }
+
+        const Math::vec2 start = origin + dir * t_enter;
+        int              x     = std::clamp(static_cast<int>((start.x - grid_min.x) / cell), 0, columns - 1);
+        int              y     = std::clamp(static_cast<int>((start.y - grid_min.y) / cell), 0, rows - 1);
+
+        const int    step_x  = dir.x > 0.0 ? 1 : (dir.x < 0.0 ? -1 : 0);
+        const int    step_y  = dir.y > 0.0 ? 1 : (dir.y < 0.0 ? -1 : 0);
+        const double delta_x = step_x != 0 ? cell / std::abs(dir.x) : infinity;
+        const double delta_y = step_y != 0 ? cell / std::abs(dir.y) : infinity;
+        double       next_x  = step_x != 0 ? (grid_min.x + (x + (step_x > 0 ? 1 : 0)) * cell - origin.x) / dir.x : infinity;
+        double       next_y  = step_y != 0 ? (grid_min.y + (y + (step_y > 0 ? 1 : 0)) * cell - origin.y) / dir.y : infinity;
+
+        bool found = false;
+        hit.t      = infinity;
+        while (true)
+        {
+            const size_t c = static_cast<size_t>(CellIndex(x, y));
+            double       t;
+            size_t       entry;
+            if (cell_segments.ClosestHit(origin, dir, cell_start[c], cell_start[c + 1], min_t, max_t, t, entry))
+            {
+                const uint32_t index = cell_segments.Id(entry);
+                if (t < hit.t || (t == hit.t && index < hit.index))
+                {
+                    hit   = { t, origin + dir * t, index };
+                    found = true;
+                }
+            }
+
+            // Anything in later cells is further away than the end of this one
+            const double cell_exit = std::min({ next_x, next_y, t_exit });
+            if ((found && hit.t <= cell_exit) || cell_exit >= t_exit)
+            {
+                break;
+            }
+
+            if (next_x < next_y)
+            {
+                x += step_x;
+                next_x += delta_x;
+            }
+            else
+            {
+                y += step_y;
+                next_y += delta_y;
+            }
+            if (x < 0 || x >= columns || y < 0 || y >= rows)
+            {
+                break;
+            }
+        }
+        return found;
+    }
+}
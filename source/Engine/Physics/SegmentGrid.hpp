@@ -0,0 +1,69 @@
+#pragma once
+#include "Reflection.hpp"
+#include "SegmentSoA.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Physics
+{
+    // Uniform grid over segments that do not move (level walls) for laser ray casts.
+    // Each cell lists the segments whose bounding box touches it; Raycast walks only the cells
+    // along the ray and stops at the first cell that holds the closest hit.
+    class SegmentGrid
+    {
+    public:
+        struct Hit
+        {
+            double     t = 0.0;
+            Math::vec2 point{};
+            size_t     index = 0;
+        };
+
+        // cell_size <= 0 picks a size from the level bounds and segment count
+        void Build(std::vector<LineSegment> in_segments, double cell_size = 0.0);
+        void Clear();
+
+        // Closest segment hit with min_t < t <= max_t along a normalized direction.
+        // Equal distances resolve to the lower segment index, as in a linear scan.
+        bool Raycast(Math::vec2 origin, Math::vec2 dir, double min_t, double max_t, Hit& hit) const;
+
+        const std::vector<LineSegment>& GetSegments() const
+        {
+            return segments;
+        }
+
+        bool Empty() const
+        {
+            return segments.empty();
+        }
+
+        size_t CellCount() const
+        {
+            return static_cast<size_t>(columns) * static_cast<size_t>(rows);
+        }
+
+        // Bumped by every Build and Clear; a cached trace is stale once this differs
+        uint64_t Revision() const
+        {
+            return revision;
+        }
+
+    private:
+        int CellIndex(int x, int y) const
+        {
+            return y * columns + x;
+        }
+
+        std::vector<LineSegment> segments;
+        // Cell c owns cell_segments entries [cell_start[c], cell_start[c + 1]), in ascending segment index.
+        // A segment spanning several cells is copied into each so every cell is one contiguous run for the kernel.
+        std::vector<uint32_t> cell_start;
+        SegmentSoA            cell_segments;
+        Math::vec2            grid_min{};
+        Math::vec2            grid_max{};
+        double                cell     = 1.0;
+        int                   columns  = 0;
+        int                   rows     = 0;
+        uint64_t              revision = 0;
+    };
+}
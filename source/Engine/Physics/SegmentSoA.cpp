@@ -0,0 +1,293 @@
+#include "SegmentSoA.hpp"
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#    include <immintrin.h>
+#    define PHYSICS_SEGMENT_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define PHYSICS_SEGMENT_SSE2
+#endif
+
+namespace
+{
+    constexpr double epsilon = std::numeric_limits<double>::epsilon();
+
+    // Same arithmetic and acceptance test as Physics::RaySegmentIntersection
+    inline bool ScalarHit(double px, double py, double rx, double ry, double x1, double y1, double sx, double sy, double& t)
+    {
+        const double rxs   = rx * sy - ry * sx;
+        const double qmpx  = x1 - px;
+        const double qmpy  = y1 - py;
+        const double qmpxr = qmpx * ry - qmpy * rx;
+        const double qmpxs = qmpx * sy - qmpy * sx;
+        if (std::abs(rxs) < epsilon)
+        {
+            return false;
+        }
+        t              = qmpxs / rxs;
+        const double u = qmpxr / rxs;
+        return t >= -epsilon && u >= -epsilon && u <= 1.0 + epsilon;
+    }
+
+#if defined(PHYSICS_SEGMENT_AVX)
+    struct Lanes
+    {
+        using Vec                     = __m256d;
+        static constexpr size_t count = 4;
+
+        static Vec Load(const double* p)
+        {
+            return _mm256_loadu_pd(p);
+        }
+
+        static Vec Set(double v)
+        {
+            return _mm256_set1_pd(v);
+        }
+
+        static Vec Sub(Vec a, Vec b)
+        {
+            return _mm256_sub_pd(a, b);
+        }
+
+        static Vec Mul(Vec a, Vec b)
+        {
+            return _mm256_mul_pd(a, b);
+        }
+
+        static Vec Div(Vec a, Vec b)
+        {
+            return _mm256_div_pd(a, b);
+        }
+
+        static Vec And(Vec a, Vec b)
+        {
+            return _mm256_and_pd(a, b);
+        }
+
+        static Vec Or(Vec a, Vec b)
+        {
+            return _mm256_or_pd(a, b);
+        }
+
+        static Vec Ge(Vec a, Vec b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+        }
+
+        static Vec Gt(Vec a, Vec b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+        }
+
+        static Vec Le(Vec a, Vec b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+        }
+
+        static int Mask(Vec m)
+        {
+            return _mm256_movemask_pd(m);
+        }
+
+        static void Store(double* p, Vec v)
+        {
+            _mm256_storeu_pd(p, v);
+        }
+    };
+#elif defined(PHYSICS_SEGMENT_SSE2)
+    struct Lanes
+    {
+        using Vec                     = __m128d;
+        static constexpr size_t count = 2;
+
+        static Vec Load(const double* p)
+        {
+            return _mm_loadu_pd(p);
+        }
+
+        static Vec Set(double v)
+        {
+            return _mm_set1_pd(v);
+        }
+
+        static Vec Sub(Vec a, Vec b)
+        {
+            return _mm_sub_pd(a, b);
+        }
+
+        static Vec Mul(Vec a, Vec b)
+        {
+            return _mm_mul_pd(a, b);
+        }
+
+        static Vec Div(Vec a, Vec b)
+        {
+            return _mm_div_pd(a, b);
+        }
+
+        static Vec And(Vec a, Vec b)
+        {
+            return _mm_and_pd(a, b);
+        }
+
+        static Vec Or(Vec a, Vec b)
+        {
+            return _mm_or_pd(a, b);
+        }
+
+        static Vec Ge(Vec a, Vec b)
+        {
+            return _mm_cmpge_pd(a, b);
+        }
+
+        static Vec Gt(Vec a, Vec b)
+        {
+            return _mm_cmpgt_pd(a, b);
+        }
+
+        static Vec Le(Vec a, Vec b)
+        {
+            return _mm_cmple_pd(a, b);
+        }
+
+        static int Mask(Vec m)
+        {
+            return _mm_movemask_pd(m);
+        }
+
+        static void Store(double* p, Vec v)
+        {
+            _mm_storeu_pd(p, v);
+        }
+    };
+#endif
+}
+
+namespace Physics
+{
+    void SegmentSoA::Clear()
+    {
+        x1.clear();
+        y1.clear();
+        dx.clear();
+        dy.clear();
+        ids.clear();
+    }
+
+    void SegmentSoA::Reserve(size_t count)
+    {
+        x1.reserve(count);
+        y1.reserve(count);
+        dx.reserve(count);
+        dy.reserve(count);
+        ids.reserve(count);
+    }
+
+    void SegmentSoA::Add(const LineSegment& segment, uint32_t id)
+    {
+        const Math::vec2 s = segment.p2 - segment.p1;
+        x1.push_back(segment.p1.x);
+        y1.push_back(segment.p1.y);
+        dx.push_back(s.x);
+        dy.push_back(s.y);
+        ids.push_back(id);
+    }
+
+    const char* SegmentSoA::KernelName()
+    {
+#if defined(PHYSICS_SEGMENT_AVX)
+        return "AVX";
+#elif defined(PHYSICS_SEGMENT_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    bool SegmentSoA::ClosestHit(Math::vec2 origin, Math::vec2 dir, size_t begin, size_t end, double min_t, double max_t, double& out_t, size_t& out_entry) const
+    {
+        const double px = origin.x;
+        const double py = origin.y;
+        const double rx = dir.x;
+        const double ry = dir.y;
+
+        double best_t     = std::numeric_limits<double>::infinity();
+        size_t best_entry = end;
+        size_t i          = begin;
+
+#if defined(PHYSICS_SEGMENT_AVX) || defined(PHYSICS_SEGMENT_SSE2)
+        using Vec              = Lanes::Vec;
+        constexpr size_t lanes = Lanes::count;
+
+        const Vec v_px      = Lanes::Set(px);
+        const Vec v_py      = Lanes::Set(py);
+        const Vec v_rx      = Lanes::Set(rx);
+        const Vec v_ry      = Lanes::Set(ry);
+        const Vec v_eps     = Lanes::Set(epsilon);
+        const Vec v_neg_eps = Lanes::Set(-epsilon);
+        const Vec v_one_eps = Lanes::Set(1.0 + epsilon);
+        const Vec v_min_t   = Lanes::Set(min_t);
+        const Vec v_max_t   = Lanes::Set(max_t);
+        const Vec v_zero    = Lanes::Set(0.0);
+
+        for (; i + lanes <= end; i += lanes)
+        {
+            const Vec sx    = Lanes::Load(dx.data() + i);
+            const Vec sy    = Lanes::Load(dy.data() + i);
+            const Vec qmpx  = Lanes::Sub(Lanes::Load(x1.data() + i), v_px);
+            const Vec qmpy  = Lanes::Sub(Lanes::Load(y1.data() + i), v_py);
+            const Vec rxs   = Lanes::Sub(Lanes::Mul(v_rx, sy), Lanes::Mul(v_ry, sx));
+            const Vec qmpxr = Lanes::Sub(Lanes::Mul(qmpx, v_ry), Lanes::Mul(qmpy, v_rx));
+            const Vec qmpxs = Lanes::Sub(Lanes::Mul(qmpx, sy), Lanes::Mul(qmpy, sx));
+
+            // |rxs| >= epsilon without a sign mask: rxs >= eps or -rxs >= eps
+            const Vec not_parallel = Lanes::Or(Lanes::Ge(rxs, v_eps), Lanes::Ge(Lanes::Sub(v_zero, rxs), v_eps));
+            const Vec t            = Lanes::Div(qmpxs, rxs);
+            const Vec u            = Lanes::Div(qmpxr, rxs);
+
+            Vec accept = Lanes::And(not_parallel, Lanes::Ge(t, v_neg_eps));
+            accept     = Lanes::And(accept, Lanes::And(Lanes::Ge(u, v_neg_eps), Lanes::Le(u, v_one_eps)));
+            accept     = Lanes::And(accept, Lanes::And(Lanes::Gt(t, v_min_t), Lanes::Le(t, v_max_t)));
+
+            const int mask = Lanes::Mask(accept);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            alignas(32) double ts[lanes];
+            Lanes::Store(ts, t);
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                if (((mask >> lane) & 1) != 0 && ts[lane] < best_t)
+                {
+                    best_t     = ts[lane];
+                    best_entry = i + lane;
+                }
+            }
+        }
+#endif
+
+        // Remainder (and the whole range when no SIMD kernel is available)
+        for (; i < end; ++i)
+        {
+            double t;
+            if (ScalarHit(px, py, rx, ry, x1[i], y1[i], dx[i], dy[i], t) && t > min_t && t <= max_t && t < best_t)
+            {
+                best_t     = t;
+                best_entry = i;
+            }
+        }
+
+        if (best_entry == end)
+        {
+            return false;
+        }
+        out_t     = best_t;
+        out_entry = best_entry;
+        return true;
+    }
+}
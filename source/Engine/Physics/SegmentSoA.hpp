@@ -0,0 +1,42 @@
+#pragma once
+#include "Reflection.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Physics
+{
+    // Segments kept as separate coordinate arrays so one ray can be tested against several segments per instruction.
+    // The kernel is picked at compile time: AVX (4 segments per step), SSE2 (2 per step) or plain scalar code.
+    // Everything stays in double so hits match RaySegmentIntersection exactly.
+    class SegmentSoA
+    {
+    public:
+        void Clear();
+        void Reserve(size_t count);
+        void Add(const LineSegment& segment, uint32_t id);
+
+        size_t Size() const
+        {
+            return ids.size();
+        }
+
+        // Caller's id for entry i (the index into whatever the segments were copied from)
+        uint32_t Id(size_t i) const
+        {
+            return ids[i];
+        }
+
+        // Closest entry in [begin, end) hit with min_t < t <= max_t. Equal distances keep the earlier entry.
+        bool ClosestHit(Math::vec2 origin, Math::vec2 dir, size_t begin, size_t end, double min_t, double max_t, double& out_t, size_t& out_entry) const;
+
+        // Name of the kernel this build uses, for benchmark output
+        static const char* KernelName();
+
+    private:
+        std::vector<double>   x1;
+        std::vector<double>   y1;
+        std::vector<double>   dx;
+        std::vector<double>   dy;
+        std::vector<uint32_t> ids;
+    };
+}
@@ -0,0 +1,87 @@
+#include "SegmentSoABench.hpp"
+#include "SegmentSoA.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <utility>
+
+void Physics::BenchmarkRayKernel(const std::vector<Physics::LineSegment>& segments)
+{
+    if (segments.empty())
+    {
+        std::cout << "bench-rays: no terrain loaded\n";
+        return;
+    }
+
+    Math::vec2 min = segments[0].p1;
+    Math::vec2 max = min;
+    for (const Physics::LineSegment& segment : segments)
+    {
+        min = { std::min(min.x, segment.p1.x), std::min(min.y, segment.p1.y) };
+        max = { std::max(max.x, segment.p1.x), std::max(max.y, segment.p1.y) };
+    }
+
+    // Origins on a grid over the level, directions spread by the golden angle
+    constexpr int                                  grid_side = 32;
+    constexpr int                                  per_point = 8;
+    std::vector<std::pair<Math::vec2, Math::vec2>> rays;
+    for (int i = 0; i < grid_side * grid_side * per_point; ++i)
+    {
+        const int        cell   = i / per_point;
+        const Math::vec2 origin = { min.x + (max.x - min.x) * ((cell % grid_side) + 0.5) / grid_side, min.y + (max.y - min.y) * ((cell / grid_side) + 0.5) / grid_side };
+        const double     angle  = static_cast<double>(i) * 2.399963229728653;
+        rays.push_back({ origin, { std::cos(angle), std::sin(angle) } });
+    }
+
+    Physics::SegmentSoA soa;
+    soa.Reserve(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        soa.Add(segments[i], static_cast<uint32_t>(i));
+    }
+
+    constexpr double    min_t        = 0.1;
+    size_t              scalar_hits  = 0;
+    size_t              batched_hits = 0;
+    size_t              mismatches   = 0;
+    std::vector<size_t> scalar_index(rays.size(), segments.size());
+
+    const auto scalar_start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rays.size(); ++r)
+    {
+        double best_t = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            Math::vec2 point;
+            double     t;
+            if (Physics::RaySegmentIntersection(rays[r].first, rays[r].second, segments[i].p1, segments[i].p2, point, t) && t > min_t && t < best_t)
+            {
+                best_t          = t;
+                scalar_index[r] = i;
+            }
+        }
+        scalar_hits += scalar_index[r] != segments.size() ? 1u : 0u;
+    }
+    const double scalar_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - scalar_start).count();
+
+    const auto batched_start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rays.size(); ++r)
+    {
+        double t;
+        size_t entry = segments.size();
+        if (soa.ClosestHit(rays[r].first, rays[r].second, 0, soa.Size(), min_t, std::numeric_limits<double>::infinity(), t, entry))
+        {
+            ++batched_hits;
+        }
+        mismatches += entry != scalar_index[r] ? 1u : 0u;
+    }
+    const double batched_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batched_start).count();
+
+    const double tests = static_cast<double>(rays.size()) * static_cast<double>(segments.size());
+    std::cout << "bench-rays: " << rays.size() << " rays x " << segments.size() << " segments\n"
+              << "  scalar:  " << scalar_seconds * 1e9 / tests << " ns/test, " << scalar_hits << " hits\n"
+              << "  " << Physics::SegmentSoA::KernelName() << ": " << batched_seconds * 1e9 / tests << " ns/test, " << batched_hits << " hits, " << mismatches << " mismatches\n"
+              << "  speedup: " << (batched_seconds > 0.0 ? scalar_seconds / batched_seconds : 0.0) << "x\n";
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include "Reflection.hpp"
+#include <vector>
+
+namespace Physics
+{
+    // --bench-rays (with --headless): casts a fixed fan of rays against every segment, once with the scalar
+    // RaySegmentIntersection loop and once with the batched SegmentSoA kernel, and prints ns per ray-segment test
+    void BenchmarkRayKernel(const std::vector<LineSegment>& segments);
+}
@@ -35,7 +35,7 @@ struct [[nodiscard]] Polygon
         return center;
     }
 
-    Math::rect FindBoundary()
+    Math::rect FindBoundary() const
     {
         if (vertices.empty())
         {
@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "PolygonEdges.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr double EDGE_NORMAL_SAMPLE_OFFSET = 3.0;
+
+    bool PointInsidePolygon(const Polygon& polygon, Math::vec2 point)
+    {
+        bool        inside = false;
+        const auto& verts  = polygon.vertices;
+
+        if (verts.empty())
+        {
+            return false;
+        }
+
+        for (size_t i = 0, j = verts.size() - 1; i < verts.size(); j = i++)
+        {
+            const Math::vec2 vi = verts[i];
+            const Math::vec2 vj = verts[j];
+
+            const bool intersect = ((vi.y > point.y) != (vj.y > point.y)) && (point.x < (vj.x - vi.x) * (point.y - vi.y) / ((vj.y - vi.y) + 0.000001) + vi.x);
+
+            if (intersect)
+            {
+                inside = !inside;
+            }
+        }
+
+        return inside;
+    }
+
+    Math::vec2 GetEdgeOutwardNormal(const Polygon& polygon, Math::vec2 p1, Math::vec2 p2)
+    {
+        constexpr double EDGE_EPS = 0.000001;
+
+        const Math::vec2 edge = p2 - p1;
+
+        Math::vec2 normal{ -edge.y, edge.x };
+
+        const double normal_length_sq = normal.LengthSquared();
+
+        if (normal_length_sq < EDGE_EPS)
+        {
+            return { 0.0, 0.0 };
+        }
+
+        normal = normal * (1.0 / std::sqrt(normal_length_sq));
+
+        const Math::vec2 mid{ (p1.x + p2.x) * 0.5, (p1.y + p2.y) * 0.5 };
+
+        const bool plus_inside  = PointInsidePolygon(polygon, mid + normal * EDGE_NORMAL_SAMPLE_OFFSET);
+        const bool minus_inside = PointInsidePolygon(polygon, mid - normal * EDGE_NORMAL_SAMPLE_OFFSET);
+
+        // If +normal side is inside and -normal side is outside,
+        // then normal points inward, so flip it.
+        if (plus_inside && !minus_inside)
+        {
+            normal = normal * -1.0;
+        }
+        else if (plus_inside == minus_inside)
+        {
+            // Unreliable edge classification.
+            // This can happen near complex concave regions or tiny edges.
+            return { 0.0, 0.0 };
+        }
+
+        return normal;
+    }
+
+    double GetEdgeAngleDegrees(Math::vec2 p1, Math::vec2 p2)
+    {
+        const double dx = p2.x - p1.x;
+        const double dy = p2.y - p1.y;
+
+        if (std::abs(dx) < 0.000001 && std::abs(dy) < 0.000001)
+        {
+            return 0.0;
+        }
+
+        return std::atan2(std::abs(dy), std::abs(dx)) * 180.0 / PI;
+    }
+}
+
+namespace CS230
+{
+    void PolygonEdges::Build(const Polygon& polygon)
+    {
+        const auto& verts = polygon.vertices;
+
+        edges.clear();
+        edges.reserve(verts.size());
+
+        std::vector<StaticBVH::Item> items;
+        items.reserve(verts.size());
+
+        for (size_t i = 0; i < verts.size(); ++i)
+        {
+            Edge edge;
+            edge.p1            = verts[i];
+            edge.p2            = verts[(i + 1) % verts.size()];
+            edge.outward       = GetEdgeOutwardNormal(polygon, edge.p1, edge.p2);
+            edge.angle_degrees = GetEdgeAngleDegrees(edge.p1, edge.p2);
+            edge.bounds        = {
+                { std::min(edge.p1.x, edge.p2.x), std::min(edge.p1.y, edge.p2.y) },
+                { std::max(edge.p1.x, edge.p2.x), std::max(edge.p1.y, edge.p2.y) }
+            };
+
+            items.push_back({ edge.bounds, static_cast<uint32_t>(i) });
+            edges.push_back(edge);
+        }
+
+        bvh.Build(std::move(items));
+    }
+
+    void PolygonEdges::Clear()
+    {
+        edges.clear();
+        bvh.Clear();
+    }
+
+    void PolygonEdges::Query(const Math::rect& bounds, std::vector<uint32_t>& out) const
+    {
+        out.clear();
+        bvh.Query(bounds, out);
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Polygon.h"
+#include "Rect.hpp"
+#include "StaticBVH.hpp"
+#include "Vec2.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace CS230
+{
+    // Edges of a world-space polygon with their outward normals and slopes worked out once, so terrain
+    // resolvers do not re-run point-in-polygon tests per edge per frame. Edge i runs from vertex i to vertex i + 1.
+    class PolygonEdges
+    {
+    public:
+        struct Edge
+        {
+            Math::vec2 p1;
+            Math::vec2 p2;
+            Math::vec2 outward;           // Unit normal pointing out of the polygon; zero when probing both sides was inconclusive
+            double     angle_degrees = 0; // 0 is horizontal, 90 is vertical
+            Math::rect bounds;
+        };
+
+        void Build(const Polygon& polygon);
+        void Clear();
+
+        // Replaces out with the index of every edge whose box overlaps bounds, in ascending order
+        void Query(const Math::rect& bounds, std::vector<uint32_t>& out) const;
+
+        const Edge& operator[](size_t index) const
+        {
+            return edges[index];
+        }
+
+        size_t Size() const
+        {
+            return edges.size();
+        }
+
+        size_t Next(size_t index) const
+        {
+            return (index + 1) % edges.size();
+        }
+
+        size_t Previous(size_t index) const
+        {
+            return (index + edges.size() - 1) % edges.size();
+        }
+
+    private:
+        std::vector<Edge> edges;
+        StaticBVH         bvh;
+    };
+}
@@ -26,6 +26,16 @@ namespace
 
 namespace util
 {
+    void seed_random(uint64_t seed) noexcept
+    {
+        Engine().seed(seed);
+    }
+
+    uint64_t random_bits() noexcept
+    {
+        return Engine()();
+    }
+
     double random(double min_inclusive, double max_exclusive) noexcept
     {
         assert(min_inclusive < max_exclusive);
@@ -6,9 +6,14 @@
  * \copyright DigiPen Institute of Technology
  */
 #pragma once
+#include <cstdint>
 
 namespace util
 {
+    // Reseeds the calling thread's generator so a run can be reproduced (input replay)
+    void     seed_random(uint64_t seed) noexcept;
+    uint64_t random_bits() noexcept;
+
     double random(double min_inclusive = 0.0, double max_exclusive = 1.0) noexcept;
     int    random(int min_inclusive, int max_exclusive) noexcept;
     int    random(int max_exclusive) noexcept;
@@ -7,6 +7,18 @@
 #include <iostream>
 #include <sstream>
 
+namespace
+{
+    // Unknown names are logged and fall back to the immediate renderer
+    Renderer2DType ParseRenderer(const std::string& name)
+    {
+        if (const auto type = ParseRenderer2DType(name))
+            return *type;
+        Engine::GetLogger().LogError("Unknown Renderer '" + name + "' in settings; expected immediate, batch or instanced. Using immediate.");
+        return Renderer2DType::Immediate;
+    }
+}
+
 namespace CS230
 {
     SettingsManager& SettingsManager::Instance()
@@ -55,6 +67,26 @@ namespace CS230
         return currentSettings.frameLimit;
     }
 
+    bool SettingsManager::IsFixedTimestep() const
+    {
+        return currentSettings.fixedTimestep;
+    }
+
+    int SettingsManager::GetTickRate() const
+    {
+        return currentSettings.tickRate;
+    }
+
+    int SettingsManager::GetMaxCatchUpSteps() const
+    {
+        return currentSettings.maxCatchUpSteps;
+    }
+
+    const std::string& SettingsManager::GetRenderer() const
+    {
+        return currentSettings.renderer;
+    }
+
     void SettingsManager::SetResolution(int width, int height)
     {
         currentSettings.resolutionX = width;
@@ -101,6 +133,13 @@ namespace CS230
         currentSettings.showFPS = show;
     }
 
+    void SettingsManager::SetFixedTimestep(bool enabled, int tickRate, int maxCatchUpSteps)
+    {
+        currentSettings.fixedTimestep   = enabled;
+        currentSettings.tickRate        = std::max(1, tickRate);
+        currentSettings.maxCatchUpSteps = std::max(1, maxCatchUpSteps);
+    }
+
     void SettingsManager::ApplyAllSettings()
     {
         // Apply window settings
@@ -121,6 +160,8 @@ namespace CS230
         AudioManager::SetBGMVolume(static_cast<int>(bgm * 14.0f));
         AudioManager::SetSFXVolume(static_cast<int>(sfx *  8.0f));
 
+        Engine::Instance().SetRenderer2D(ParseRenderer(currentSettings.renderer));
+
         Engine::GetLogger().LogEvent("Settings Applied Successfully.");
     }
 
@@ -169,6 +210,14 @@ namespace CS230
                             currentSettings.frameLimit = std::max(0, std::stoi(value));
                         else if (key == "ShowFPS")
                             currentSettings.showFPS = (value == "1" || value == "true");
+                        else if (key == "FixedTimestep")
+                            currentSettings.fixedTimestep = (value == "1" || value == "true");
+                        else if (key == "TickRate")
+                            currentSettings.tickRate = std::max(1, std::stoi(value));
+                        else if (key == "MaxCatchUpSteps")
+                            currentSettings.maxCatchUpSteps = std::max(1, std::stoi(value));
+                        else if (key == "Renderer")
+                            currentSettings.renderer = value;
                     }
                     catch (const std::exception& e)
                     {
@@ -198,6 +247,10 @@ namespace CS230
         file << "SFXVolume=" << currentSettings.sfxVolume << "\n";
         file << "FrameLimit=" << currentSettings.frameLimit << "\n";
         file << "ShowFPS=" << (currentSettings.showFPS ? "1" : "0") << "\n";
+        file << "FixedTimestep=" << (currentSettings.fixedTimestep ? "1" : "0") << "\n";
+        file << "TickRate=" << currentSettings.tickRate << "\n";
+        file << "MaxCatchUpSteps=" << currentSettings.maxCatchUpSteps << "\n";
+        file << "Renderer=" << currentSettings.renderer << "\n";
 
         Engine::GetLogger().LogEvent(std::string("Settings Saved to ") + filepath.string());
     }
@@ -18,6 +18,14 @@ namespace CS230
         int         frameLimit   = 60;
         bool        showFPS      = false;
         std::string language     = "English";
+
+        // Opt-in fixed simulation rate; rendering interpolates between the last two ticks
+        bool fixedTimestep   = false;
+        int  tickRate        = 120;
+        int  maxCatchUpSteps = 8;
+
+        // immediate draws every primitive on its own; batch and instanced collect each scene into a few draw calls
+        std::string renderer = "immediate";
     };
 
     class SettingsManager
@@ -38,6 +46,10 @@ namespace CS230
         [[nodiscard]] float               GetBGMVolume() const;
         [[nodiscard]] float               GetSFXVolume() const;
         [[nodiscard]] int                 GetFrameLimit() const;
+        [[nodiscard]] bool                IsFixedTimestep() const;
+        [[nodiscard]] int                 GetTickRate() const;
+        [[nodiscard]] int                 GetMaxCatchUpSteps() const;
+        [[nodiscard]] const std::string&  GetRenderer() const;
 
         // Setters
         void SetResolution(int width, int height);
@@ -47,6 +59,7 @@ namespace CS230
         void SetSFXVolume(float volume);
         void SetFrameLimit(int frameLimit);
         void SetShowFPS(bool show);
+        void SetFixedTimestep(bool enabled, int tickRate, int maxCatchUpSteps);
 
         // Apply all settings to engine
         void ApplyAllSettings();
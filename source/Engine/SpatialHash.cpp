@@ -0,0 +1,227 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "SpatialHash.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CS230
+{
+    SpatialHash::SpatialHash(double cell_size) : inv_cell_size(1.0 / cell_size)
+    {
+    }
+
+    SpatialHash::CellRange SpatialHash::ToCellRange(const Math::rect& bounds) const
+    {
+        CellRange range;
+        range.min_x = static_cast<int>(std::floor(bounds.Left() * inv_cell_size));
+        range.min_y = static_cast<int>(std::floor(bounds.Bottom() * inv_cell_size));
+        range.max_x = static_cast<int>(std::floor(bounds.Right() * inv_cell_size));
+        range.max_y = static_cast<int>(std::floor(bounds.Top() * inv_cell_size));
+        return range;
+    }
+
+    void SpatialHash::Link(Proxy* proxy)
+    {
+        const CellRange& range = proxy->range;
+        for (int y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (int x = range.min_x; x <= range.max_x; ++x)
+            {
+                cells[CellKey(x, y)].push_back(proxy);
+            }
+        }
+    }
+
+    void SpatialHash::Unlink(Proxy* proxy)
+    {
+        const CellRange& range = proxy->range;
+        for (int y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (int x = range.min_x; x <= range.max_x; ++x)
+            {
+                auto cell = cells.find(CellKey(x, y));
+                if (cell == cells.end())
+                {
+                    continue;
+                }
+
+                std::vector<Proxy*>& bucket = cell->second;
+                auto                 it     = std::find(bucket.begin(), bucket.end(), proxy);
+                if (it != bucket.end())
+                {
+                    *it = bucket.back();
+                    bucket.pop_back();
+                }
+
+                if (bucket.empty())
+                {
+                    cells.erase(cell);
+                }
+            }
+        }
+    }
+
+    void SpatialHash::Update(GameObject* object, const Math::rect& bounds, uint64_t order, uint32_t layer)
+    {
+        const CellRange range = ToCellRange(bounds);
+
+        auto [it, inserted] = proxies.try_emplace(object);
+        Proxy& proxy        = it->second;
+        proxy.order         = order;
+        proxy.layer         = layer;
+
+        if (inserted)
+        {
+            proxy.object = object;
+            proxy.range  = range;
+            Link(&proxy);
+            return;
+        }
+
+        Relink(proxy, range);
+    }
+
+    void SpatialHash::Move(GameObject* object, const Math::rect& bounds)
+    {
+        auto it = proxies.find(object);
+        if (it != proxies.end())
+        {
+            Relink(it->second, ToCellRange(bounds));
+        }
+    }
+
+    void SpatialHash::Relink(Proxy& proxy, const CellRange& range)
+    {
+        // Most objects stay inside the same cells from frame to frame
+        if (proxy.range == range)
+        {
+            return;
+        }
+
+        Unlink(&proxy);
+        proxy.range = range;
+        Link(&proxy);
+    }
+
+    void SpatialHash::Remove(GameObject* object)
+    {
+        auto it = proxies.find(object);
+        if (it == proxies.end())
+        {
+            return;
+        }
+
+        Unlink(&it->second);
+        proxies.erase(it);
+    }
+
+    void SpatialHash::Clear()
+    {
+        cells.clear();
+        proxies.clear();
+    }
+
+    void SpatialHash::BeginQuery() const
+    {
+        if (++query_counter == 0)
+        {
+            for (auto& entry : proxies)
+            {
+                entry.second.query_mark = 0;
+            }
+            query_counter = 1;
+        }
+
+        query_scratch.clear();
+    }
+
+    void SpatialHash::CollectCell(int x, int y, uint32_t mask) const
+    {
+        auto cell = cells.find(CellKey(x, y));
+        if (cell == cells.end())
+        {
+            return;
+        }
+
+        for (Proxy* proxy : cell->second)
+        {
+            if ((proxy->layer & mask) != 0 && proxy->query_mark != query_counter)
+            {
+                proxy->query_mark = query_counter;
+                query_scratch.push_back(proxy);
+            }
+        }
+    }
+
+    void SpatialHash::FinishQuery(std::vector<GameObject*>& out) const
+    {
+        std::sort(query_scratch.begin(), query_scratch.end(), [](const Proxy* a, const Proxy* b) { return a->order < b->order; });
+
+        for (const Proxy* proxy : query_scratch)
+        {
+            out.push_back(proxy->object);
+        }
+    }
+
+    void SpatialHash::Query(const Math::rect& bounds, std::vector<GameObject*>& out, uint32_t mask) const
+    {
+        BeginQuery();
+
+        const CellRange range = ToCellRange(bounds);
+        for (int y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (int x = range.min_x; x <= range.max_x; ++x)
+            {
+                CollectCell(x, y, mask);
+            }
+        }
+
+        FinishQuery(out);
+    }
+
+    void SpatialHash::QueryCapsule(Math::vec2 a, Math::vec2 b, double radius, std::vector<GameObject*>& out, uint32_t mask) const
+    {
+        BeginQuery();
+
+        const double cell_size    = 1.0 / inv_cell_size;
+        const double delta_x      = b.x - a.x;
+        const double delta_y      = b.y - a.y;
+        const int    first_column = static_cast<int>(std::floor((std::min(a.x, b.x) - radius) * inv_cell_size));
+        const int    last_column  = static_cast<int>(std::floor((std::max(a.x, b.x) + radius) * inv_cell_size));
+
+        for (int x = first_column; x <= last_column; ++x)
+        {
+            // Part of the segment close enough in x to reach this column, as segment parameters t0..t1
+            double t0 = 0.0;
+            double t1 = 1.0;
+            if (std::abs(delta_x) > 0.0)
+            {
+                const double column_left  = static_cast<double>(x) * cell_size - radius;
+                const double column_right = static_cast<double>(x + 1) * cell_size + radius;
+                t0                        = std::max(0.0, std::min((column_left - a.x) / delta_x, (column_right - a.x) / delta_x));
+                t1                        = std::min(1.0, std::max((column_left - a.x) / delta_x, (column_right - a.x) / delta_x));
+                if (t0 > t1)
+                {
+                    continue;
+                }
+            }
+
+            const double y0        = a.y + delta_y * t0;
+            const double y1        = a.y + delta_y * t1;
+            const int    first_row = static_cast<int>(std::floor((std::min(y0, y1) - radius) * inv_cell_size));
+            const int    last_row  = static_cast<int>(std::floor((std::max(y0, y1) + radius) * inv_cell_size));
+            for (int y = first_row; y <= last_row; ++y)
+            {
+                CollectCell(x, y, mask);
+            }
+        }
+
+        FinishQuery(out);
+    }
+}
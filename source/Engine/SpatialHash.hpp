@@ -0,0 +1,104 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Rect.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CS230
+{
+    class GameObject;
+
+    // Uniform grid broad phase keyed by hashed cell coordinates.
+    // Objects are only re-bucketed when the cells covered by their AABB change,
+    // so static geometry costs nothing after the first insert.
+    class SpatialHash
+    {
+    public:
+        explicit SpatialHash(double cell_size = 256.0);
+
+        // Inserts the object or moves it to the cells covered by the new bounds.
+        // order is carried along so queries can be returned in a stable order;
+        // layer is matched against the mask passed to Query.
+        void Update(GameObject* object, const Math::rect& bounds, uint64_t order, uint32_t layer = ~uint32_t{ 0 });
+        // Re-buckets an object that is already tracked, keeping its order
+        void Move(GameObject* object, const Math::rect& bounds);
+        void Remove(GameObject* object);
+        void Clear();
+
+        // Appends every object whose cells overlap bounds and whose layer is in mask,
+        // without duplicates, sorted by order
+        void Query(const Math::rect& bounds, std::vector<GameObject*>& out, uint32_t mask = ~uint32_t{ 0 }) const;
+
+        // Same, but only the cells a circle of the given radius sweeps through moving from a to b.
+        // A long diagonal segment touches far fewer cells than its bounding box.
+        void QueryCapsule(Math::vec2 a, Math::vec2 b, double radius, std::vector<GameObject*>& out, uint32_t mask = ~uint32_t{ 0 }) const;
+
+        bool Contains(GameObject* object) const
+        {
+            return proxies.find(object) != proxies.end();
+        }
+
+        size_t ObjectCount() const
+        {
+            return proxies.size();
+        }
+
+        size_t CellCount() const
+        {
+            return cells.size();
+        }
+
+    private:
+        struct CellRange
+        {
+            int min_x = 0;
+            int min_y = 0;
+            int max_x = -1;
+            int max_y = -1;
+
+            bool operator==(const CellRange& other) const
+            {
+                return min_x == other.min_x && min_y == other.min_y && max_x == other.max_x && max_y == other.max_y;
+            }
+        };
+
+        struct Proxy
+        {
+            GameObject*       object = nullptr;
+            CellRange         range;
+            uint64_t          order      = 0;
+            uint32_t          layer      = 0;
+            mutable uint32_t  query_mark = 0;
+        };
+
+        CellRange ToCellRange(const Math::rect& bounds) const;
+        void      Link(Proxy* proxy);
+        void      Unlink(Proxy* proxy);
+        void      Relink(Proxy& proxy, const CellRange& range);
+
+        void BeginQuery() const;
+        void CollectCell(int x, int y, uint32_t mask) const;
+        void FinishQuery(std::vector<GameObject*>& out) const;
+
+        static uint64_t CellKey(int x, int y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(y));
+        }
+
+        double inv_cell_size;
+
+        std::unordered_map<uint64_t, std::vector<Proxy*>> cells;
+        std::unordered_map<GameObject*, Proxy>            proxies;
+
+        mutable uint32_t            query_counter = 0;
+        mutable std::vector<Proxy*> query_scratch;
+    };
+}
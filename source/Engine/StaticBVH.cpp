@@ -0,0 +1,143 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "StaticBVH.hpp"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    constexpr size_t max_leaf_items = 4;
+    constexpr size_t max_depth      = 64;
+
+    // Stored boxes are normalized so point_1 is the minimum corner and point_2 the maximum
+    Math::rect Normalized(const Math::rect& r)
+    {
+        return { { r.Left(), r.Bottom() }, { r.Right(), r.Top() } };
+    }
+
+    Math::rect Merge(const Math::rect& a, const Math::rect& b)
+    {
+        return { { std::min(a.point_1.x, b.point_1.x), std::min(a.point_1.y, b.point_1.y) }, { std::max(a.point_2.x, b.point_2.x), std::max(a.point_2.y, b.point_2.y) } };
+    }
+
+    bool Overlaps(const Math::rect& a, const Math::rect& b)
+    {
+        return a.point_1.x <= b.point_2.x && b.point_1.x <= a.point_2.x && a.point_1.y <= b.point_2.y && b.point_1.y <= a.point_2.y;
+    }
+}
+
+namespace CS230
+{
+    void StaticBVH::Build(std::vector<Item> items)
+    {
+        nodes.clear();
+        leaf_items = std::move(items);
+
+        if (leaf_items.empty())
+        {
+            return;
+        }
+
+        for (Item& item : leaf_items)
+        {
+            item.bounds = Normalized(item.bounds);
+        }
+
+        nodes.reserve(leaf_items.size() * 2 / max_leaf_items + 1);
+        BuildNode(0, leaf_items.size());
+    }
+
+    void StaticBVH::Clear()
+    {
+        nodes.clear();
+        leaf_items.clear();
+    }
+
+    uint32_t StaticBVH::BuildNode(size_t begin, size_t end)
+    {
+        const uint32_t index = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+
+        Math::rect bounds  = leaf_items[begin].bounds;
+        Math::vec2 min_mid = (bounds.point_1 + bounds.point_2) * 0.5;
+        Math::vec2 max_mid = min_mid;
+        for (size_t i = begin + 1; i < end; ++i)
+        {
+            const Math::rect& b   = leaf_items[i].bounds;
+            const Math::vec2  mid = (b.point_1 + b.point_2) * 0.5;
+            bounds                = Merge(bounds, b);
+            min_mid               = { std::min(min_mid.x, mid.x), std::min(min_mid.y, mid.y) };
+            max_mid               = { std::max(max_mid.x, mid.x), std::max(max_mid.y, mid.y) };
+        }
+        nodes[index].bounds = bounds;
+
+        if (end - begin <= max_leaf_items)
+        {
+            nodes[index].first = static_cast<uint32_t>(begin);
+            nodes[index].count = static_cast<uint32_t>(end - begin);
+            return index;
+        }
+
+        // Median split along the axis where the item centers are most spread out
+        const bool   split_x = (max_mid.x - min_mid.x) >= (max_mid.y - min_mid.y);
+        const size_t middle  = begin + (end - begin) / 2;
+        auto         center  = [split_x](const Item& item) { return split_x ? item.bounds.point_1.x + item.bounds.point_2.x : item.bounds.point_1.y + item.bounds.point_2.y; };
+        std::nth_element(
+            leaf_items.begin() + static_cast<std::ptrdiff_t>(begin), leaf_items.begin() + static_cast<std::ptrdiff_t>(middle), leaf_items.begin() + static_cast<std::ptrdiff_t>(end),
+            [&center](const Item& a, const Item& b) { return center(a) < center(b); });
+
+        BuildNode(begin, middle);
+        const uint32_t right = BuildNode(middle, end);
+        nodes[index].first   = right;
+        return index;
+    }
+
+    void StaticBVH::Query(const Math::rect& bounds, std::vector<uint32_t>& out) const
+    {
+        if (nodes.empty())
+        {
+            return;
+        }
+
+        const Math::rect query = Normalized(bounds);
+        const size_t     start = out.size();
+
+        std::array<uint32_t, max_depth> stack;
+        size_t                          stack_size = 0;
+        stack[stack_size++]                        = 0;
+
+        while (stack_size > 0)
+        {
+            const Node& node = nodes[stack[--stack_size]];
+            if (!Overlaps(node.bounds, query))
+            {
+                continue;
+            }
+
+            if (node.count > 0)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    if (Overlaps(leaf_items[i].bounds, query))
+                    {
+                        out.push_back(leaf_items[i].id);
+                    }
+                }
+                continue;
+            }
+
+            const uint32_t left = static_cast<uint32_t>(&node - nodes.data()) + 1;
+            stack[stack_size++] = node.first;
+            stack[stack_size++] = left;
+        }
+
+        // Callers rely on a deterministic order (collision resolution order, laser segment order)
+        std::sort(out.begin() + static_cast<std::ptrdiff_t>(start), out.end());
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Rect.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace CS230
+{
+    // Bounding volume hierarchy over boxes that do not move after it is built (level terrain).
+    // Queries hand back the ids that were passed to Build.
+    class StaticBVH
+    {
+    public:
+        struct Item
+        {
+            Math::rect bounds;
+            uint32_t   id = 0;
+        };
+
+        void Build(std::vector<Item> items);
+        void Clear();
+
+        // Appends the id of every item whose box overlaps bounds, in ascending id order
+        void Query(const Math::rect& bounds, std::vector<uint32_t>& out) const;
+
+        bool Empty() const
+        {
+            return nodes.empty();
+        }
+
+        size_t ItemCount() const
+        {
+            return leaf_items.size();
+        }
+
+        size_t NodeCount() const
+        {
+            return nodes.size();
+        }
+
+    private:
+        // Leaves have count > 0 and own leaf_items[first, first + count).
+        // Inner nodes have their left child right after them and the right child at index first.
+        struct Node
+        {
+            Math::rect bounds;
+            uint32_t   first = 0;
+            uint32_t   count = 0;
+        };
+
+        uint32_t BuildNode(size_t begin, size_t end);
+
+        std::vector<Node> nodes;
+        std::vector<Item> leaf_items;
+    };
+}
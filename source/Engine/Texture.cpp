@@ -20,8 +20,12 @@ namespace CS230
     Texture::Texture(const std::filesystem::path& file_name)
     {
         CS200::Image image(file_name, true);
-        size          = image.GetSize();
-        textureHandle = OpenGL::CreateTextureFromImage(image);
+        size = image.GetSize();
+        // Headless runs keep the size (sprites need it for frame math) but never upload
+        if (!Engine::IsHeadless())
+        {
+            textureHandle = OpenGL::CreateTextureFromImage(image);
+        }
     }
 
     Texture::Texture(OpenGL::TextureHandle given_texture, Math::ivec2 the_size) : textureHandle(given_texture), size(the_size)
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "TriggerVolumes.hpp"
+#include <algorithm>
+
+namespace
+{
+    bool Overlaps(const Math::rect& a, const Math::rect& b)
+    {
+        return a.Left() <= b.Right() && b.Left() <= a.Right() && a.Bottom() <= b.Top() && b.Bottom() <= a.Top();
+    }
+}
+
+namespace CS230
+{
+    TriggerVolumes::TriggerVolumes(double cell_size) : grid(cell_size)
+    {
+    }
+
+    void TriggerVolumes::Set(GameObject* object, const Math::rect& bounds, uint64_t order, uint32_t layer)
+    {
+        volumes[object] = bounds;
+        grid.Update(object, bounds, order, layer);
+    }
+
+    void TriggerVolumes::Remove(GameObject* object)
+    {
+        if (volumes.erase(object) > 0)
+        {
+            grid.Remove(object);
+        }
+    }
+
+    void TriggerVolumes::Clear()
+    {
+        grid.Clear();
+        volumes.clear();
+    }
+
+    void TriggerVolumes::QueryPoint(Math::vec2 point, std::vector<GameObject*>& out, uint32_t mask) const
+    {
+        QueryAABB({ point, point }, out, mask);
+    }
+
+    void TriggerVolumes::QueryAABB(const Math::rect& bounds, std::vector<GameObject*>& out, uint32_t mask) const
+    {
+        const size_t start = out.size();
+        grid.Query(bounds, out, mask);
+        Filter(bounds, out, start);
+    }
+
+    void TriggerVolumes::Filter(const Math::rect& bounds, std::vector<GameObject*>& out, size_t start) const
+    {
+        // The grid only knows which cells a volume covers; keep the ones whose box really overlaps
+        auto outside = [this, &bounds](GameObject* object) { return !Overlaps(volumes.at(object), bounds); };
+        out.erase(std::remove_if(out.begin() + static_cast<std::ptrdiff_t>(start), out.end(), outside), out.end());
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "GameObjectTypes.hpp"
+#include "Rect.hpp"
+#include "SpatialHash.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CS230
+{
+    class GameObject;
+
+    // Axis-aligned regions owned by game objects (water, hazards, reading ranges) in their own grid, so
+    // "which volumes am I in" costs as much as the volumes nearby instead of every volume in the level.
+    // Each object owns at most one volume.
+    class TriggerVolumes
+    {
+    public:
+        static constexpr uint32_t Layer(GameObjectTypes type)
+        {
+            return uint32_t{ 1 } << static_cast<uint32_t>(type);
+        }
+
+        explicit TriggerVolumes(double cell_size = 256.0);
+
+        // Adds the volume or moves it to new bounds. order sorts query results; layer is matched against query masks.
+        void Set(GameObject* object, const Math::rect& bounds, uint64_t order, uint32_t layer);
+        // Drops the object's volume
+        void Remove(GameObject* object);
+        void Clear();
+
+        // Append every volume in mask containing the point (edges included), sorted by order
+        void QueryPoint(Math::vec2 point, std::vector<GameObject*>& out, uint32_t mask = ~uint32_t{ 0 }) const;
+        // Append every volume in mask overlapping bounds (touching counts), sorted by order
+        void QueryAABB(const Math::rect& bounds, std::vector<GameObject*>& out, uint32_t mask = ~uint32_t{ 0 }) const;
+
+        bool Contains(GameObject* object) const
+        {
+            return volumes.find(object) != volumes.end();
+        }
+
+        size_t VolumeCount() const
+        {
+            return volumes.size();
+        }
+
+    private:
+        void Filter(const Math::rect& bounds, std::vector<GameObject*>& out, size_t start) const;
+
+        SpatialHash                                 grid;
+        std::unordered_map<GameObject*, Math::rect> volumes;
+    };
+}
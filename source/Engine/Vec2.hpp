@@ -16,6 +16,8 @@ constexpr double PI = std::numbers::pi;
 
 namespace Math
 {
+    // Everything here is inline (and constexpr where the standard library allows) so the
+    // collision, laser and draw code that leans on these helpers can have them inlined without LTO
     struct vec2
     {
         double x{ 0.0 };
@@ -27,39 +29,109 @@ namespace Math
         {
         }
 
-        [[nodiscard]] bool operator==(const vec2& v) const;
-        [[nodiscard]] bool operator!=(const vec2& v) const;
+        [[nodiscard]] constexpr bool operator==(const vec2& v) const
+        {
+            return x == v.x && y == v.y;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const vec2& v) const
+        {
+            return x != v.x || y != v.y;
+        }
+
+        [[nodiscard]] constexpr vec2 operator+(const vec2& v) const
+        {
+            return { x + v.x, y + v.y };
+        }
+
+        constexpr vec2& operator+=(const vec2& v)
+        {
+            x += v.x;
+            y += v.y;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr vec2 operator-(const vec2& v) const
+        {
+            return { x - v.x, y - v.y };
+        }
+
+        constexpr vec2& operator-=(const vec2& v)
+        {
+            x -= v.x;
+            y -= v.y;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr vec2 operator*(const double scale) const
+        {
+            return { x * scale, y * scale };
+        }
+
+        constexpr vec2& operator*=(const double scale)
+        {
+            x *= scale;
+            y *= scale;
+            return *this;
+        }
 
-        [[nodiscard]] vec2 operator+(const vec2& v) const;
-        vec2&              operator+=(const vec2& v);
+        [[nodiscard]] constexpr vec2 operator/(const double divisor) const
+        {
+            return { x / divisor, y / divisor };
+        }
+
+        constexpr vec2& operator/=(const double divisor)
+        {
+            x /= divisor;
+            y /= divisor;
+            return *this;
+        }
 
-        [[nodiscard]] vec2 operator-(const vec2& v) const;
-        vec2&              operator-=(const vec2& v);
+        [[nodiscard]] constexpr vec2 operator-() const
+        {
+            return { -x, -y };
+        }
 
-        [[nodiscard]] vec2 operator*(const double scale) const;
-        vec2&              operator*=(const double scale);
+        // std::sqrt is not constexpr until C++26
+        [[nodiscard]] double Length() const
+        {
+            return std::sqrt(x * x + y * y);
+        }
 
-        [[nodiscard]] vec2 operator/(const double divisor) const;
-        vec2&              operator/=(const double divisor);
+        [[nodiscard]] constexpr double LengthSquared() const
+        {
+            return (x * x) + (y * y);
+        }
 
-        [[nodiscard]] vec2 operator-() const;
+        [[nodiscard]] vec2 Normalize() const
+        {
+            const double len = Length();
+            if (len > std::numeric_limits<double>::epsilon())
+            {
+                return { x / len, y / len };
+            }
+            return { 0.0, 0.0 };
+        }
 
-        [[nodiscard]] double Length() const;
-        [[nodiscard]] double LengthSquared() const;
-        [[nodiscard]] vec2   Normalize() const;
-        [[nodiscard]] double Dot(const vec2& v) const;
+        [[nodiscard]] constexpr double Dot(const vec2& v) const
+        {
+            return x * v.x + y * v.y;
+        }
     };
 
-    [[nodiscard]] vec2 operator*(double scale, const vec2& v);
+    [[nodiscard]] constexpr vec2 operator*(double scale, const vec2& v)
+    {
+        return { scale * v.x, scale * v.y };
+    }
 
     // Dot Product
-    [[nodiscard]] inline double dot(const vec2& v1, const vec2& v2)
+    [[nodiscard]] constexpr double dot(const vec2& v1, const vec2& v2)
     {
         return v1.x * v2.x + v1.y * v2.y;
     }
 
     // Get Perpendicular Vector
-    [[nodiscard]] inline vec2 GetPerpendicular(const vec2& v)
+    [[nodiscard]] constexpr vec2 GetPerpendicular(const vec2& v)
     {
         return { v.y, -v.x };
     }
@@ -72,29 +144,82 @@ namespace Math
         constexpr ivec2() = default;
         constexpr ivec2(int x_, int y_) : x(x_), y(y_) { };
 
-        explicit operator vec2() const
+        constexpr explicit operator vec2() const
         {
             return vec2{ static_cast<double>(x), static_cast<double>(y) };
         }
 
-        [[nodiscard]] bool operator==(const ivec2& v) const;
-        [[nodiscard]] bool operator!=(const ivec2& v) const;
+        [[nodiscard]] constexpr bool operator==(const ivec2& v) const
+        {
+            return x == v.x && y == v.y;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const ivec2& v) const
+        {
+            return x != v.x || y != v.y;
+        }
+
+        [[nodiscard]] constexpr ivec2 operator+(const ivec2& v) const
+        {
+            return { x + v.x, y + v.y };
+        }
+
+        constexpr ivec2& operator+=(const ivec2& v)
+        {
+            x += v.x;
+            y += v.y;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr ivec2 operator-(const ivec2& v) const
+        {
+            return { x - v.x, y - v.y };
+        }
+
+        constexpr ivec2& operator-=(const ivec2& v)
+        {
+            x -= v.x;
+            y -= v.y;
+            return *this;
+        }
 
-        [[nodiscard]] ivec2  operator+(const ivec2& v) const;
-        ivec2& operator+=(const ivec2& v);
+        [[nodiscard]] constexpr ivec2 operator*(const int scale) const
+        {
+            return { x * scale, y * scale };
+        }
 
-        [[nodiscard]] ivec2  operator-(const ivec2& v) const;
-        ivec2& operator-=(const ivec2& v);
+        constexpr ivec2& operator*=(const int scale)
+        {
+            x *= scale;
+            y *= scale;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr ivec2 operator/(const int divisor) const
+        {
+            return { x / divisor, y / divisor };
+        }
 
-        [[nodiscard]] ivec2  operator*(const int scale) const;
-        ivec2& operator*=(const int scale);
+        constexpr ivec2& operator/=(const int divisor)
+        {
+            x /= divisor;
+            y /= divisor;
+            return *this;
+        }
 
-        [[nodiscard]] ivec2  operator/(const int divisor) const;
-        ivec2& operator/=(const int divisor);
+        [[nodiscard]] constexpr vec2 operator*(const double scale) const
+        {
+            return { x * scale, y * scale };
+        }
 
-        [[nodiscard]] vec2 operator*(const double scale) const;
-        [[nodiscard]] vec2 operator/(const double divisor) const;
+        [[nodiscard]] constexpr vec2 operator/(const double divisor) const
+        {
+            return { x / divisor, y / divisor };
+        }
 
-        [[nodiscard]] ivec2 operator-() const;
+        [[nodiscard]] constexpr ivec2 operator-() const
+        {
+            return { -x, -y };
+        }
     };
 }
\ No newline at end of file
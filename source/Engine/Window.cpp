@@ -88,8 +88,19 @@ namespace CS230
         is_closed = false;
     }
 
+    void Window::StartHeadless(Math::ivec2 headless_size)
+    {
+        size      = headless_size;
+        is_closed = false;
+    }
+
     void Window::Update()
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         SDL_GL_SwapWindow(sdlWindow);
         SDL_Event event{ 0 };
         while (SDL_PollEvent(&event) != 0)
@@ -127,12 +138,23 @@ namespace CS230
 
     void Window::Clear(CS200::RGBA color)
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         CS200::RenderingAPI::SetClearColor(color);
         CS200::RenderingAPI::Clear();
     }
 
     void Window::ForceResize(int desired_width, int desired_height)
     {
+        if (sdlWindow == nullptr)
+        {
+            size = { desired_width, desired_height };
+            return;
+        }
+
         const Math::ivec2 fitted_size = fit_size_to_current_display(sdlWindow, { desired_width, desired_height });
         SDL_SetWindowSize(sdlWindow, fitted_size.x, fitted_size.y);
         SDL_SetWindowPosition(sdlWindow, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
@@ -142,6 +164,11 @@ namespace CS230
 
     void Window::SetFullscreen(bool fullscreen)
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         if (fullscreen)
         {
             // Use SDL_WINDOW_FULLSCREEN_DESKTOP to prevent desktop windows from rearranging
@@ -157,11 +184,21 @@ namespace CS230
 
     void Window::SetBordered(bool bordered)
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         SDL_SetWindowBordered(sdlWindow, bordered ? SDL_TRUE : SDL_FALSE);
     }
 
     void Window::SetVSync(bool enabled)
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         if (!enabled)
         {
             SDL_GL_SetSwapInterval(0);
@@ -193,6 +230,11 @@ namespace CS230
 
     Window::~Window()
     {
+        if (sdlWindow == nullptr)
+        {
+            return;
+        }
+
         SDL_GL_DeleteContext(glContext);
         SDL_DestroyWindow(sdlWindow);
         SDL_Quit();
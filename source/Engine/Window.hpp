@@ -25,6 +25,8 @@ namespace CS230
     {
     public:
         void          Start(std::string_view title);
+        // No SDL window or GL context; size is reported as given and everything else is a no-op
+        void          StartHeadless(Math::ivec2 headless_size);
         void          Update();
         bool          IsClosed() const;
         Math::ivec2   GetSize() const;
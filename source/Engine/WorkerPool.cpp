@@ -0,0 +1,103 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+namespace CS230
+{
+    WorkerPool::WorkerPool([[maybe_unused]] unsigned thread_count)
+    {
+#if !defined(__EMSCRIPTEN__)
+        if (thread_count == 0)
+        {
+            const unsigned cores = std::thread::hardware_concurrency();
+            thread_count         = cores > 1 ? cores - 1 : 0;
+        }
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back([this] { WorkerLoop(); });
+        }
+#endif
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& in_job)
+    {
+        if (threads.empty() || count <= 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                in_job(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard lock(mutex);
+            job            = &in_job;
+            job_count      = count;
+            active_workers = static_cast<unsigned>(threads.size());
+            next_index.store(0);
+            ++generation;
+        }
+        wake.notify_all();
+
+        RunJobs();
+
+        // Workers still hold a pointer to in_job until they check out
+        std::unique_lock lock(mutex);
+        finished.wait(lock, [this] { return active_workers == 0; });
+        job = nullptr;
+    }
+
+    void WorkerPool::RunJobs()
+    {
+        for (size_t i = next_index.fetch_add(1); i < job_count; i = next_index.fetch_add(1))
+        {
+            (*job)(i);
+        }
+    }
+
+    void WorkerPool::WorkerLoop()
+    {
+        uint64_t seen_generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(mutex);
+                wake.wait(lock, [this, seen_generation] { return stopping || generation != seen_generation; });
+                if (stopping)
+                {
+                    return;
+                }
+                seen_generation = generation;
+            }
+
+            RunJobs();
+
+            {
+                std::lock_guard lock(mutex);
+                --active_workers;
+            }
+            finished.notify_one();
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CS230
+{
+    // Fixed set of threads for splitting per-frame work that only reads shared state (laser traces).
+    // ParallelFor blocks until every index has run and the calling thread takes a share too,
+    // so with no worker threads (Emscripten, single core) it simply runs the loop inline.
+    class WorkerPool
+    {
+    public:
+        // thread_count 0 uses one thread per hardware core minus the caller
+        explicit WorkerPool(unsigned thread_count = 0);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&)            = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        void ParallelFor(size_t count, const std::function<void(size_t)>& job);
+
+        // Worker threads, not counting the caller
+        unsigned ThreadCount() const
+        {
+            return static_cast<unsigned>(threads.size());
+        }
+
+    private:
+        void WorkerLoop();
+        void RunJobs();
+
+        std::vector<std::thread> threads;
+        std::mutex               mutex;
+        std::condition_variable  wake;
+        std::condition_variable  finished;
+
+        const std::function<void(size_t)>* job = nullptr;
+        size_t                             job_count      = 0;
+        std::atomic<size_t>                next_index     = 0;
+        unsigned                           active_workers = 0;
+        uint64_t                           generation     = 0;
+        bool                               stopping       = false;
+    };
+}
@@ -22,7 +22,7 @@ Bonfire::Bonfire(Math::vec2 in_start_pos, Math::vec2 in_size) : CS230::GameObjec
 void Bonfire::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     CS200::IRenderer2D&        renderer  = Engine::GetRenderer2D();
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(bonfireSize);
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(bonfireSize);
 
     renderer.DrawRectangle(transform, 0xFF0000FF, CS200::CLEAR, 0.0);
 
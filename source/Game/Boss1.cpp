@@ -7,6 +7,7 @@
 #include "Door.hpp"
 #include "DoorActionHandler.hpp"
 #include "Gate.hpp"
+#include "LaserBatch.hpp"
 #include "LaserStar.hpp"
 #include "LightOrbManager.hpp"
 #include "ObjectFactory.hpp"
@@ -44,25 +45,21 @@ void Boss1::BuildConstellation()
 
     constellation = new Constellation("Aries");
 
-    for (auto obj : gom->GetObjects())
+    for (auto obj : gom->GetObjectsOfType(GameObjectTypes::Star))
     {
-        if (obj == nullptr)
+        if (obj->TypeName() == "LaserStar" && obj->GetName() == "LS_Y_SHOT_TRACK_E_ARIESMAIN")
         {
-            continue;
+            constellation->SetMainStar(static_cast<LaserStar*>(obj));
         }
+    }
 
+    for (auto obj : gom->GetObjectsOfType(GameObjectTypes::Target))
+    {
         const std::string& name = obj->GetName();
 
-        if (obj->TypeName() == "LaserStar" && name == "LS_Y_SHOT_TRACK_E_ARIESMAIN")
+        if (name == "ARIES_T_01" || name == "ARIES_T_02" || name == "ARIES_T_03")
         {
-            constellation->SetMainStar(static_cast<LaserStar*>(obj));
-        }
-        else if (obj->TypeName() == "TargetStar")
-        {
-            if (name == "ARIES_T_01" || name == "ARIES_T_02" || name == "ARIES_T_03")
-            {
-                constellation->AddTargetStar(static_cast<TargetStar*>(obj));
-            }
+            constellation->AddTargetStar(static_cast<TargetStar*>(obj));
         }
     }
 
@@ -85,13 +82,8 @@ void Boss1::DisableLegacyLaserStars()
         mainStar = constellation->GetMainStar();
     }
 
-    for (auto obj : gom->GetObjects())
+    for (auto obj : gom->GetObjectsOfType(GameObjectTypes::Star))
     {
-        if (obj == nullptr)
-        {
-            continue;
-        }
-
         if (obj->TypeName() != "LaserStar")
         {
             continue;
@@ -130,6 +122,7 @@ void Boss1::Load()
     currentState = State::Loading;
 
     AddGSComponent(new CS230::GameObjectManager());
+    AddGSComponent(new LaserBatch());
 #ifdef DEVELOPER_VERSION
     AddGSComponent(new CS230::ShowCollision());
 #endif
@@ -296,6 +289,7 @@ void Boss1::Update(double dt)
     auto gom = GetGSComponent<CS230::GameObjectManager>();
 
     gom->UpdateAll(dt);
+    GetGSComponent<LaserBatch>()->Resolve();
     gom->CollisionTest();
 
     if (currentState == State::Playing)
@@ -338,13 +332,10 @@ void Boss1::Update(double dt)
 
     if (puzzleGate == nullptr)
     {
-        for (auto obj : gom->GetObjects())
+        const std::vector<CS230::GameObject*>& gates = gom->GetObjectsOfType(GameObjectTypes::Gate);
+        if (!gates.empty())
         {
-            if (obj->TypeName() == "Gate")
-            {
-                puzzleGate = static_cast<Gate*>(obj);
-                break;
-            }
+            puzzleGate = static_cast<Gate*>(gates.front());
         }
     }
 
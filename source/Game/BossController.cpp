@@ -295,7 +295,7 @@ void BossController::AdvanceAfterReflect()
 
     if (player != nullptr && hasReflectReturnPosition)
     {
-        player->SetPosition(reflectReturnPosition);
+        player->Teleport(reflectReturnPosition);
         player->velocityY         = 0.0;
         player->isInteracting     = false;
         player->interactionTarget = nullptr;
@@ -86,7 +86,7 @@ namespace Boss
     void BossLaser::SetStartPosition(Math::vec2 start)
     {
         startPosition = start;
-        SetPosition(start);
+        Teleport(start);
     }
 
     void BossLaser::SetDirection(Math::vec2 newDirection)
@@ -3,6 +3,7 @@
 #include "BossConfig.hpp"
 #include "BossLaser.hpp"
 #include "BossLaserManager.hpp"
+#include "Engine/Random.hpp"
 #include "LaserStar.hpp"
 #include "Player.hpp"
 
@@ -29,7 +30,7 @@ namespace
 
 namespace Boss
 {
-    BossPatternController::BossPatternController(Player* in_player, BossLaserManager* in_laserManager) : player(in_player), laserManager(in_laserManager), rng(std::random_device{}())
+    BossPatternController::BossPatternController(Player* in_player, BossLaserManager* in_laserManager) : player(in_player), laserManager(in_laserManager), rng(static_cast<uint32_t>(util::random_bits()))
     {
     }
 
@@ -21,7 +21,7 @@ void Door::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     CS200::IRenderer2D& renderer = Engine::GetRenderer2D();
 
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(size);
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(size);
 
     renderer.DrawRectangle(transform, 0x8B4513FF, CS200::WHITE, 2.0);
 
@@ -48,7 +48,7 @@ DoorActionHandler::Result DoorActionHandler::Execute(Door& door, Player& player)
 
         case Door::ActionType::Teleport:
             {
-                player.SetPosition(config.teleportPosition);
+                player.Teleport(config.teleportPosition);
 
                 Engine::GetLogger().LogEvent("Door teleport: " + door.GetName() + " -> (" + std::to_string(config.teleportPosition.x) + ", " + std::to_string(config.teleportPosition.y) + ")");
 
@@ -77,12 +77,12 @@ void Elevator::Update(double dt)
 void Elevator::Draw(const Math::TransformationMatrix& /*camera_matrix*/)
 {
     auto&            r   = Engine::GetRenderer2D();
-    const Math::vec2 pos = GetPosition();
+    const Math::vec2 pos = GetRenderPosition();
     const double     hw  = size.x * 0.5;
     const double     hh  = size.y * 0.5;
 
     // Body
-    const auto bodyMat = GetMatrix() * Math::ScaleMatrix(size);
+    const auto bodyMat = GetRenderMatrix() * Math::ScaleMatrix(size);
     r.DrawRectangle(bodyMat, 0x1A2844FF, 0x3366BBFF, 2.0);
 
     // Top surface highlight
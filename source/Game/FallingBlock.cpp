@@ -35,12 +35,12 @@ void FallingBlock::Update(double dt)
 void FallingBlock::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     auto&            renderer = Engine::GetRenderer2D();
-    const Math::vec2 pos      = GetPosition();
+    const Math::vec2 pos      = GetRenderPosition();
     const double     hw       = size.x * 0.5;
     const double     hh       = size.y * 0.5;
 
     // Stone block fill
-    const auto fillMat = GetMatrix() * Math::ScaleMatrix(size);
+    const auto fillMat = GetRenderMatrix() * Math::ScaleMatrix(size);
     renderer.DrawRectangle(fillMat, 0x1A1410FF, 0x6A5040FF, 2.0);
 
     // Masonry lines — horizontal crack
@@ -81,7 +81,7 @@ void FallingBlock::ResolveCollision(CS230::GameObject* other_object)
         }
 
         Math::rect my_box    = my_collider->WorldBoundary();
-        Math::rect floor_box = floor_collider->WorldBoundary().FindBoundary();
+        Math::rect floor_box = floor_collider->WorldBoundingBox();
 
         const bool horizontal_overlap = my_box.Right() > floor_box.Left() && my_box.Left() < floor_box.Right();
 
@@ -2,6 +2,8 @@
 #include "CS200/IRenderer2D.hpp"
 #include "Engine/Collision.hpp"
 #include "Engine/Engine.hpp"
+#include "Engine/GameObjectManager.hpp"
+#include "Engine/GameStateManager.hpp"
 #include "Engine/Logger.hpp"
 
 Gate::Gate(Math::vec2 in_position, Math::vec2 in_size) : CS230::GameObject(in_position), size(in_size), isOpen(false), color(0xFF00FFFF)
@@ -26,7 +28,7 @@ void Gate::Draw(const Math::TransformationMatrix& camera_matrix)
     if (!isOpen)
     {
         auto&                      renderer  = Engine::GetRenderer2D();
-        Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(size);
+        Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(size);
         renderer.DrawRectangle(transform, color, CS200::WHITE, 2.0);
         CS230::GameObject::Draw(camera_matrix);
     }
@@ -52,6 +54,7 @@ void Gate::Open()
     {
         isOpen = true;
         RemoveGOComponent<CS230::RectCollision>();
+        InvalidateLaserOccluders();
         Engine::GetLogger().LogEvent("Gate Opened!");
     }
 }
@@ -68,7 +71,30 @@ void Gate::Close()
             {  static_cast<int>(size.x / 2.0),  static_cast<int>(size.y / 2.0) }
         };
         AddGOComponent(new CS230::RectCollision(collision_box, this));
+        InvalidateLaserOccluders();
 
         Engine::GetLogger().LogEvent("Gate Closed!");
     }
-}
\ No newline at end of file
+}
+
+void Gate::AppendLaserSegments(std::vector<Physics::LineSegment>& out)
+{
+    if (!isOpen)
+    {
+        Math::vec2 p = GetPosition();
+        out.push_back(
+            {
+                { p.x - 50, p.y },
+                { p.x + 50, p.y },
+                false
+        });
+    }
+}
+
+void Gate::InvalidateLaserOccluders()
+{
+    if (auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>())
+    {
+        gom->InvalidateLaserOccluders();
+    }
+}
@@ -2,6 +2,7 @@
 #include "CS200/RGBA.hpp"
 #include "Engine/GameObject.hpp"
 #include "Engine/GameObjectTypes.hpp"
+#include "Engine/Physics/Reflection.hpp"
 #include "Engine/Vec2.hpp"
 #include <string>
 
@@ -16,6 +17,9 @@ public:
     // Check if player can pass through based on current state
     bool CanCollideWith(GameObjectTypes other_object_type) override;
 
+    // Closed gates absorb lasers
+    void AppendLaserSegments(std::vector<Physics::LineSegment>& out) override;
+
     [[nodiscard]] GameObjectTypes Type() override
     {
         return GameObjectTypes::Gate;
@@ -35,6 +39,8 @@ public:
     }
 
 private:
+    void InvalidateLaserOccluders();
+
     Math::vec2  size;
     bool        isOpen;
     CS200::RGBA color;
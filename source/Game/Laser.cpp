@@ -4,10 +4,8 @@
 #include "Engine/GameObjectManager.hpp"
 #include "Engine/GameStateManager.hpp"
 #include "Engine/MapElement.h"
-#include "Gate.hpp"
-#include "Mirror.hpp"
+#include "LaserBatch.hpp"
 #include "Player.hpp"
-#include "PushableMirror.hpp"
 #include "Shield.hpp"
 #include "TargetStar.hpp"
 #include <algorithm>
@@ -74,8 +72,31 @@ Laser::Laser(Math::vec2 in_startPos, Math::vec2 dir, Player* in_player) : CS230:
 
 void Laser::CalculatePath(int maxBounces, double maxLength)
 {
-    std::vector<Physics::LineSegment> allSegments;
+    PreparePath(maxBounces, maxLength);
+    TracePath();
+}
+
+void Laser::RequestPath(int maxBounces, double maxLength, double dt)
+{
+    PreparePath(maxBounces, maxLength);
+
+    LaserBatch* batch = Engine::GetGameStateManager().GetGSComponent<LaserBatch>();
+    if (batch != nullptr && !GetHandle().IsNull())
+    {
+        batch->Add(this, dt);
+        return;
+    }
+
+    TracePath();
+    OnPathReady(dt);
+}
+
+void Laser::PreparePath(int maxBounces, double maxLength)
+{
+    traceBounces = maxBounces;
+    traceLength  = maxLength;
 
+    shieldSegments.clear();
     if (player != nullptr)
     {
         Shield* shield = player->GetShield();
@@ -100,52 +121,99 @@ void Laser::CalculatePath(int maxBounces, double maxLength)
                 if (direction.Dot(normal) < 0)
                 {
                     for (const auto& s : segs)
-                        allSegments.push_back({ s.first, s.second, true });
+                        shieldSegments.push_back({ s.first, s.second, true });
                 }
             }
         }
     }
 
-    auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
-    if (gom != nullptr)
+    // Terrain walls come from the level's segment grid; only the moving pieces below are tested one by one
+    auto gom  = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
+    traceGrid = gom != nullptr ? &gom->GetTerrainSegments() : nullptr;
+
+    // Mirrors and closed gates are cached by the manager until one of them changes
+    const std::vector<Physics::LineSegment>* occluders     = gom != nullptr ? &gom->GetDynamicLaserSegments() : nullptr;
+    const uint64_t                           occluderEpoch = gom != nullptr ? gom->GetLaserOccluderEpoch() : 0;
+
+    traceNeeded = !PathIsCurrent(gom, occluderEpoch);
+    if (!traceNeeded)
+    {
+        return;
+    }
+
+    tracedInputs.start         = startPos;
+    tracedInputs.direction     = direction;
+    tracedInputs.bounces       = traceBounces;
+    tracedInputs.length        = traceLength;
+    tracedInputs.grid          = traceGrid;
+    tracedInputs.gridRevision  = traceGrid != nullptr ? traceGrid->Revision() : 0;
+    tracedInputs.occluderEpoch = occluderEpoch;
+    tracedInputs.shield        = shieldSegments;
+
+    // Reused between traces so a steady-state trace does not allocate
+    traceSegments.assign(shieldSegments.begin(), shieldSegments.end());
+    if (occluders != nullptr)
+    {
+        traceSegments.insert(traceSegments.end(), occluders->begin(), occluders->end());
+    }
+}
+
+bool Laser::PathIsCurrent(CS230::GameObjectManager* gom, uint64_t occluderEpoch)
+{
+    const TraceInputs& traced = tracedInputs;
+    if (pathPoints.size() < 2 || traced.bounces != traceBounces || traced.length != traceLength || !(traced.start == startPos) || !(traced.direction == direction))
+    {
+        return false;
+    }
+    if (traced.grid != traceGrid || (traceGrid != nullptr && traced.gridRevision != traceGrid->Revision()))
+    {
+        return false;
+    }
+
+    const auto sameSegment = [](const Physics::LineSegment& a, const Physics::LineSegment& b) { return a.p1 == b.p1 && a.p2 == b.p2 && a.isReflective == b.isReflective; };
+    if (!std::equal(traced.shield.begin(), traced.shield.end(), shieldSegments.begin(), shieldSegments.end(), sameSegment))
+    {
+        return false;
+    }
+
+    if (traced.occluderEpoch == occluderEpoch)
     {
-        for (auto obj : gom->GetObjects())
+        return true;
+    }
+
+    occluderChanges.clear();
+    if (gom == nullptr || !gom->CollectLaserOccluderChanges(traced.occluderEpoch, occluderChanges))
+    {
+        return false;
+    }
+
+    // An occluder that crossed neither its old nor its new spot on the beam cannot change the first hit of any leg.
+    // The slack covers the small offset a bounce starts from and rounding at grazing hits.
+    constexpr double slack = 0.25;
+    for (const Physics::LineSegment& change : occluderChanges)
+    {
+        for (size_t i = 0; i + 1 < pathPoints.size(); ++i)
         {
-            if (obj->Type() == GameObjectTypes::Mirror)
-            {
-                allSegments.push_back(static_cast<Mirror*>(obj)->GetReflectiveSegment());
-            }
-            else if (obj->Type() == GameObjectTypes::PushableMirror)
+            if (SegmentDistanceSquared(change.p1, change.p2, pathPoints[i], pathPoints[i + 1]) <= slack * slack)
             {
-                auto mirror = static_cast<PushableMirror*>(obj);
-                auto segs   = mirror->GetSegments();
-                for (const auto& s : segs)
-                    allSegments.push_back({ s.first, s.second, true });
-            }
-            else if (obj->Type() == GameObjectTypes::Floor)
-            {
-                auto wall = static_cast<CS230::MapElement*>(obj);
-                auto segs = wall->GetWallSegments();
-                allSegments.insert(allSegments.end(), segs.begin(), segs.end());
-            }
-            else if (obj->Type() == GameObjectTypes::Gate)
-            {
-                auto gate = static_cast<Gate*>(obj);
-                if (!gate->IsOpen())
-                {
-                    Math::vec2 p = gate->GetPosition();
-                    allSegments.push_back(
-                        {
-                            { p.x - 50, p.y },
-                            { p.x + 50, p.y },
-                            false
-                    });
-                }
+                return false;
             }
         }
     }
 
-    auto calculatedPath = Physics::CalculateLaserPath(startPos, direction, allSegments, maxBounces, maxLength);
+    tracedInputs.occluderEpoch = occluderEpoch;
+    return true;
+}
+
+void Laser::TracePath()
+{
+    if (!traceNeeded)
+    {
+        return;
+    }
+
+    auto calculatedPath = traceGrid != nullptr ? Physics::CalculateLaserPath(startPos, direction, *traceGrid, traceSegments, traceBounces, traceLength)
+                                               : Physics::CalculateLaserPath(startPos, direction, traceSegments, traceBounces, traceLength);
 
     pathPoints.clear();
     if (!calculatedPath.empty())
@@ -159,10 +227,16 @@ void Laser::CalculatePath(int maxBounces, double maxLength)
     else
     {
         pathPoints.push_back(startPos);
-        pathPoints.push_back(startPos + direction * maxLength);
+        pathPoints.push_back(startPos + direction * traceLength);
     }
 }
 
+void Laser::InvalidatePath()
+{
+    tracedInputs.bounces = -1;
+    traceNeeded          = true;
+}
+
 void Laser::CheckTargetIntersections(double hitRadius)
 {
     auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
@@ -174,18 +248,18 @@ void Laser::CheckTargetIntersections(double hitRadius)
         Math::vec2 p1 = pathPoints[i];
         Math::vec2 p2 = pathPoints[i + 1];
 
-        for (auto obj : gom->GetObjects())
+        // Only targets near this leg of the beam; each target's own radius is already part of its indexed bounds
+        hitCandidates.clear();
+        gom->QueryCapsule(p1, p2, hitRadius, GameObjectTypes::Target, hitCandidates);
+        for (auto obj : hitCandidates)
         {
-            if (obj->Type() == GameObjectTypes::Target)
+            TargetStar* target = static_cast<TargetStar*>(obj);
+            if (!target->IsHit())
             {
-                TargetStar* target = static_cast<TargetStar*>(obj);
-                if (target && !target->IsHit())
+                double r = target->GetRadius();
+                if (DistToSegmentSquared(target->GetPosition(), p1, p2) <= (r + hitRadius) * (r + hitRadius))
                 {
-                    double r = target->GetRadius();
-                    if (DistToSegmentSquared(target->GetPosition(), p1, p2) <= (r + hitRadius) * (r + hitRadius))
-                    {
-                        target->OnHit();
-                    }
+                    target->OnHit();
                 }
             }
         }
@@ -277,6 +351,7 @@ void Laser::SetIsActive(bool active)
     if (!isActive)
     {
         pathPoints.clear();
+        InvalidatePath();
     }
 }
 
@@ -296,3 +371,19 @@ double Laser::DistToSegmentSquared(Math::vec2 p, Math::vec2 a, Math::vec2 b)
 
     return (p - projection).LengthSquared();
 }
+
+double Laser::SegmentDistanceSquared(Math::vec2 a1, Math::vec2 a2, Math::vec2 b1, Math::vec2 b2)
+{
+    const auto cross = [](Math::vec2 u, Math::vec2 v) { return u.x * v.y - u.y * v.x; };
+
+    const double d1 = cross(b2 - b1, a1 - b1);
+    const double d2 = cross(b2 - b1, a2 - b1);
+    const double d3 = cross(a2 - a1, b1 - a1);
+    const double d4 = cross(a2 - a1, b2 - a1);
+    if (((d1 < 0.0 && d2 > 0.0) || (d1 > 0.0 && d2 < 0.0)) && ((d3 < 0.0 && d4 > 0.0) || (d3 > 0.0 && d4 < 0.0)))
+    {
+        return 0.0;
+    }
+
+    return std::min({ DistToSegmentSquared(a1, b1, b2), DistToSegmentSquared(a2, b1, b2), DistToSegmentSquared(b1, a1, a2), DistToSegmentSquared(b2, a1, a2) });
+}
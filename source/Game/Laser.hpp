@@ -2,11 +2,22 @@
 #include "CS200/RGBA.hpp"
 #include "Engine/GameObject.hpp"
 #include "Engine/Physics/Reflection.hpp"
+#include <cstdint>
 #include <vector>
 
 class Player;
 class TargetStar;
 
+namespace CS230
+{
+    class GameObjectManager;
+}
+
+namespace Physics
+{
+    class SegmentGrid;
+}
+
 class Laser : public CS230::GameObject
 {
 public:
@@ -23,6 +34,8 @@ public:
     bool IsActive() const;
 
 protected:
+    friend class LaserBatch;
+
     Math::vec2               startPos;
     Math::vec2               direction;
     Player*                  player;
@@ -31,13 +44,57 @@ protected:
     bool                     isActive = true;
     std::vector<Math::vec2>  pathPoints;
 
+    // Shield and mirror segments of the current trace; terrain comes from the manager's grid
+    std::vector<Physics::LineSegment> traceSegments;
+    const Physics::SegmentGrid*       traceGrid    = nullptr;
+    int                               traceBounces = 0;
+    double                            traceLength  = 0.0;
+    bool                              traceNeeded  = true;
+
+    // Reused by the hit tests for the objects QueryCapsule hands back
+    std::vector<CS230::GameObject*> hitCandidates;
+
     virtual bool IsBlockedByShield() const
     {
         return true;
     }
 
     void CalculatePath(int maxBounces, double maxLength);
+
+    // For lasers that retrace every tick: the path is traced together with every other laser once the
+    // objects have updated (see LaserBatch), then OnPathReady handles hits against it
+    void         RequestPath(int maxBounces, double maxLength, double dt);
+    virtual void OnPathReady([[maybe_unused]] double dt) { };
+
+    // CalculatePath in two halves. PreparePath snapshots the shield and occluder segments on the main thread;
+    // TracePath only reads that snapshot and the terrain grid, so LaserBatch can run it on a worker.
+    // When nothing the last path depended on has changed, PreparePath keeps that path and TracePath does nothing.
+    void PreparePath(int maxBounces, double maxLength);
+    void TracePath();
+    void InvalidatePath();
     void CheckTargetIntersections(double hitRadius);
 
     static double DistToSegmentSquared(Math::vec2 p, Math::vec2 a, Math::vec2 b);
+    static double SegmentDistanceSquared(Math::vec2 a1, Math::vec2 a2, Math::vec2 b1, Math::vec2 b2);
+
+private:
+    // What pathPoints was traced from. An idle beam between static mirrors keeps its path until one of these
+    // changes or an occluder that appeared or disappeared since occluderEpoch crosses the path.
+    struct TraceInputs
+    {
+        Math::vec2                        start{};
+        Math::vec2                        direction{};
+        int                               bounces       = -1;
+        double                            length        = 0.0;
+        const Physics::SegmentGrid*       grid          = nullptr;
+        uint64_t                          gridRevision  = 0;
+        uint64_t                          occluderEpoch = 0;
+        std::vector<Physics::LineSegment> shield;
+    };
+
+    TraceInputs                       tracedInputs;
+    std::vector<Physics::LineSegment> shieldSegments;
+    std::vector<Physics::LineSegment> occluderChanges;
+
+    bool PathIsCurrent(CS230::GameObjectManager* gom, uint64_t occluderEpoch);
 };
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "LaserBatch.hpp"
+#include "Engine/Engine.hpp"
+#include "Engine/GameObjectManager.hpp"
+#include "Engine/GameStateManager.hpp"
+#include "Engine/WorkerPool.hpp"
+#include "Laser.hpp"
+
+void LaserBatch::Add(Laser* laser, double dt)
+{
+    requests.push_back({ laser->GetHandle(), dt });
+}
+
+void LaserBatch::Resolve()
+{
+    if (requests.empty())
+        return;
+
+    // Handles, not pointers: a laser destroyed during the update is gone by now
+    auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
+    lasers.clear();
+    laserDts.clear();
+    for (const Request& request : requests)
+    {
+        Laser* laser = gom != nullptr ? gom->Get<Laser>(request.handle) : nullptr;
+        if (laser != nullptr && laser->IsActive())
+        {
+            lasers.push_back(laser);
+            laserDts.push_back(request.dt);
+        }
+    }
+    requests.clear();
+
+    // Traces only read their own snapshot and the terrain grid; nothing else runs meanwhile
+    Engine::GetWorkerPool().ParallelFor(lasers.size(), [this](size_t i) { lasers[i]->TracePath(); });
+
+    // Hits touch the player and targets, so they stay on this thread and in request order
+    for (size_t i = 0; i < lasers.size(); ++i)
+    {
+        lasers[i]->OnPathReady(laserDts[i]);
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Engine/Component.hpp"
+#include "Engine/GameObjectHandle.hpp"
+#include <vector>
+
+class Laser;
+
+// Collects the lasers that asked for a new path during GameObjectManager::UpdateAll and traces them
+// together across Engine::GetWorkerPool(). The state calls Resolve right after UpdateAll, so every
+// path is ready (and its hits applied) before collisions and the draw.
+class LaserBatch : public CS230::Component
+{
+public:
+    void Add(Laser* laser, double dt);
+    void Resolve();
+
+private:
+    struct Request
+    {
+        CS230::GameObjectHandle handle;
+        double                  dt = 0.0;
+    };
+
+    std::vector<Request> requests;
+    std::vector<Laser*>  lasers;
+    std::vector<double>  laserDts;
+};
@@ -85,13 +85,8 @@ void LaserCutRope::Cut()
         FallingBlock* bestBlock = nullptr;
         double        bestGap   = 999999.0;
 
-        for (auto obj : gom->GetObjects())
+        for (auto obj : gom->GetObjectsOfType(GameObjectTypes::FallingBlock))
         {
-            if (obj == nullptr || obj->Type() != GameObjectTypes::FallingBlock)
-            {
-                continue;
-            }
-
             auto block = static_cast<FallingBlock*>(obj);
 
             if (block->IsReleased())
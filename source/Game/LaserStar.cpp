@@ -470,7 +470,7 @@ bool LaserStar::IsMoveComplete() const
 
 void LaserStar::ResetMovement()
 {
-    SetPosition(startPosition);
+    Teleport(startPosition);
     movedDistance = 0.0;
     moveComplete  = false;
 
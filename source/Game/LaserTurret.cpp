@@ -236,32 +236,30 @@ void LaserTurret::UpdateBullet(BulletState& b, double dt)
     auto* gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
     if (gom)
     {
-        for (auto* obj : gom->GetObjects())
+        for (CS230::GameObject* obj : gom->GetObjectsOfType(GameObjectTypes::LaserCutRope))
         {
-            if (obj->Type() == GameObjectTypes::FallingBlock)
+            auto* rope = static_cast<LaserCutRope*>(obj);
+            if (rope->IsCut()) continue;
+            auto* col = rope->GetGOComponent<CS230::RectCollision>();
+            if (!col) continue;
+            const Math::rect box = col->WorldBoundary();
+            if (pos.x >= box.Left() && pos.x <= box.Right() &&
+                pos.y >= box.Bottom() && pos.y <= box.Top())
             {
-                auto* col = obj->GetGOComponent<CS230::RectCollision>();
-                if (!col) continue;
-                const Math::rect box = col->WorldBoundary();
-                if (pos.x >= box.Left() && pos.x <= box.Right() &&
-                    pos.y >= box.Bottom() && pos.y <= box.Top())
-                {
-                    b.dying = true; b.alpha = 1.0f;
-                    return;
-                }
+                rope->Cut(); // bullet keeps going through the rope
             }
-            else if (obj->Type() == GameObjectTypes::LaserCutRope)
+        }
+
+        for (CS230::GameObject* obj : gom->GetObjectsOfType(GameObjectTypes::FallingBlock))
+        {
+            auto* col = obj->GetGOComponent<CS230::RectCollision>();
+            if (!col) continue;
+            const Math::rect box = col->WorldBoundary();
+            if (pos.x >= box.Left() && pos.x <= box.Right() &&
+                pos.y >= box.Bottom() && pos.y <= box.Top())
             {
-                auto* rope = static_cast<LaserCutRope*>(obj);
-                if (rope->IsCut()) continue;
-                auto* col = rope->GetGOComponent<CS230::RectCollision>();
-                if (!col) continue;
-                const Math::rect box = col->WorldBoundary();
-                if (pos.x >= box.Left() && pos.x <= box.Right() &&
-                    pos.y >= box.Bottom() && pos.y <= box.Top())
-                {
-                    rope->Cut(); // bullet keeps going through the rope
-                }
+                b.dying = true; b.alpha = 1.0f;
+                return;
             }
         }
     }
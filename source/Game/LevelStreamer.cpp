@@ -1,6 +1,7 @@
 #include "LevelStreamer.hpp"
 
 #include "Engine/GameObject.hpp"
+#include "Engine/GameObjectManager.hpp"
 #include "Engine/GameObjectTypes.hpp"
 
 #include <algorithm>
@@ -70,13 +71,14 @@ int LevelStreamer::ActiveRoomCount() const
 // Init
 // ---------------------------------------------------------------------------
 
-void LevelStreamer::Init(const std::vector<Math::rect>&       rooms,
-                         const std::list<CS230::GameObject*>& objects)
+void LevelStreamer::Init(const std::vector<Math::rect>&   rooms,
+                         const CS230::GameObjectManager* gom)
 {
+    gom_ = gom;
     rooms_.clear();
     objs_.clear();
 
-    if (rooms.empty()) return;
+    if (rooms.empty() || gom == nullptr) return;
 
     // Build room states + adjacency lists
     rooms_.resize(rooms.size());
@@ -95,14 +97,14 @@ void LevelStreamer::Init(const std::vector<Math::rect>&       rooms,
     shouldFloor_ .assign(rooms_.size(), false);
 
     // Assign each object to its room
-    for (CS230::GameObject* obj : objects)
+    for (CS230::GameObject* obj : gom->GetObjects())
     {
         if (!obj) continue;
 
         const GameObjectTypes t = obj->Type();
 
         ObjRecord rec;
-        rec.obj     = obj;
+        rec.handle  = obj->GetHandle();
         rec.isFloor = (t == GameObjectTypes::Floor);
 
         // Player is managed externally, always active
@@ -185,13 +187,14 @@ void LevelStreamer::Update(Math::vec2 playerPos, double dt)
     // 4. Apply active state to every object
     for (auto& rec : objs_)
     {
-        if (!rec.obj) continue;
+        CS230::GameObject* obj = gom_->Get(rec.handle);
+        if (!obj) continue;
 
         // Always-active objects (player, or unassigned)
         if (rec.roomIdx < 0)
         {
-            rec.obj->SetIsActive(true);
-            rec.obj->SetVisible(true);
+            obj->SetIsActive(true);
+            obj->SetVisible(true);
             continue;
         }
 
@@ -201,7 +204,7 @@ void LevelStreamer::Update(Math::vec2 playerPos, double dt)
             ? (shouldFloor_[rec.roomIdx] || rooms_[rec.roomIdx].active)
             : rooms_[rec.roomIdx].active;
 
-        rec.obj->SetIsActive(roomOn);
-        rec.obj->SetVisible(roomOn);
+        obj->SetIsActive(roomOn);
+        obj->SetVisible(roomOn);
     }
 }
@@ -1,11 +1,11 @@
 #pragma once
+#include "Engine/GameObjectHandle.hpp"
 #include "Engine/Rect.hpp"
 #include "Engine/Vec2.hpp"
 
-#include <list>
 #include <vector>
 
-namespace CS230 { class GameObject; }
+namespace CS230 { class GameObjectManager; }
 
 // Activates / deactivates game objects based on which rooms are near the player.
 // Active set = current room + all NSEW-adjacent rooms.
@@ -18,8 +18,9 @@ public:
     static constexpr double DEACTIVATE_DELAY = 1.5;    // s  — lag before actually deactivating
 
     // Call once after the map finishes loading.
-    void Init(const std::vector<Math::rect>&       rooms,
-              const std::list<CS230::GameObject*>& objects);
+    // Objects are tracked by handle, so ones destroyed later are simply skipped.
+    void Init(const std::vector<Math::rect>&   rooms,
+              const CS230::GameObjectManager* gom);
 
     // Call every frame.
     void Update(Math::vec2 playerPos, double dt);
@@ -40,13 +41,14 @@ private:
     // ---- per-object record ----
     struct ObjRecord
     {
-        CS230::GameObject* obj      = nullptr;
-        int                roomIdx  = -1;   // -1 → always active
-        bool               isFloor  = false;
+        CS230::GameObjectHandle handle;
+        int                     roomIdx  = -1;   // -1 → always active
+        bool                    isFloor  = false;
     };
 
-    std::vector<RoomState> rooms_;
-    std::vector<ObjRecord> objs_;
+    const CS230::GameObjectManager* gom_ = nullptr;
+    std::vector<RoomState>          rooms_;
+    std::vector<ObjRecord>          objs_;
 
     // Pre-allocated working buffers — reused each Update() to avoid heap allocation
     std::vector<bool> shouldActive_;
@@ -82,7 +82,7 @@ namespace Boss
         const double radius = visualRadius * pulseScale;
 
         Math::TransformationMatrix transform =
-            GetMatrix() * Math::ScaleMatrix({ radius, radius });
+            GetRenderMatrix() * Math::ScaleMatrix({ radius, radius });
 
         renderer.DrawCircle(transform, 0xFFFF66FF);
     }
@@ -30,8 +30,10 @@ namespace Boss
             }
         }
 
-        for (LightOrb* orb : lightOrbs)
+        for (CS230::GameObjectHandle handle : lightOrbs)
         {
+            LightOrb* orb = Resolve(handle);
+
             if (orb == nullptr)
             {
                 continue;
@@ -73,8 +75,7 @@ namespace Boss
         LightOrb* orb = new LightOrb(position);
         orb->SetPlayer(player);
 
-        lightOrbs.push_back(orb);
-        gom->Add(orb);
+        lightOrbs.push_back(gom->Add(orb));
 
         spawnCooldownTimer = Config::LightOrbSpawnCooldown;
 
@@ -83,9 +84,9 @@ namespace Boss
 
     void LightOrbManager::Clear()
     {
-        for (LightOrb* orb : lightOrbs)
+        for (CS230::GameObjectHandle handle : lightOrbs)
         {
-            if (orb != nullptr)
+            if (LightOrb* orb = Resolve(handle); orb != nullptr)
             {
                 orb->Destroy();
             }
@@ -99,8 +100,10 @@ namespace Boss
     {
         int count = 0;
 
-        for (LightOrb* orb : lightOrbs)
+        for (CS230::GameObjectHandle handle : lightOrbs)
         {
+            const LightOrb* orb = Resolve(handle);
+
             if (orb != nullptr && !orb->Destroyed() && !orb->IsCollected())
             {
                 ++count;
@@ -115,8 +118,10 @@ namespace Boss
         const double minDistance = static_cast<double>(Config::MinLightOrbSpawnDistance);
         const double minDistanceSq = minDistance * minDistance;
 
-        for (LightOrb* orb : lightOrbs)
+        for (CS230::GameObjectHandle handle : lightOrbs)
         {
+            const LightOrb* orb = Resolve(handle);
+
             if (orb == nullptr || orb->Destroyed() || orb->IsCollected())
             {
                 continue;
@@ -139,10 +144,16 @@ namespace Boss
             std::remove_if(
                 lightOrbs.begin(),
                 lightOrbs.end(),
-                [](LightOrb* orb)
+                [this](CS230::GameObjectHandle handle)
                 {
+                    const LightOrb* orb = Resolve(handle);
                     return orb == nullptr || orb->Destroyed() || orb->IsCollected();
                 }),
             lightOrbs.end());
     }
+
+    LightOrb* LightOrbManager::Resolve(CS230::GameObjectHandle handle) const
+    {
+        return gom != nullptr ? gom->Get<LightOrb>(handle) : nullptr;
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Engine/GameObjectHandle.hpp"
 #include "Engine/Vec2.hpp"
 #include "ShieldEnergy.hpp"
 
@@ -32,14 +33,16 @@ namespace Boss
         int GetActiveOrbCount() const;
 
     private:
-        bool CanSpawnAt(Math::vec2 position) const;
-        void RemoveCollectedOrDestroyedOrbs();
+        bool      CanSpawnAt(Math::vec2 position) const;
+        void      RemoveCollectedOrDestroyedOrbs();
+        LightOrb* Resolve(CS230::GameObjectHandle handle) const;
 
         Player* player = nullptr;
         ShieldEnergy* shieldEnergy = nullptr;
         CS230::GameObjectManager* gom = nullptr;
 
-        std::vector<LightOrb*> lightOrbs;
+        // Orbs are owned by the GameObjectManager and may be deleted before we see them again
+        std::vector<CS230::GameObjectHandle> lightOrbs;
 
         double spawnCooldownTimer = 0.0;
     };
@@ -290,6 +290,22 @@ Math::vec2 MiniMap::WorldToMapCanvas(const Math::vec2& world_position, const str
     }
 }
 
+Math::rect MiniMap::VisibleWorldRect(const struct ImVec2& canvas_size) const
+{
+    if (currentMode == MiniMapMode::Mini)
+    {
+        if (!camera)
+            return Math::rect{};
+
+        Math::vec2  camPos  = camera->GetPosition();
+        Math::ivec2 winSize = Engine::GetWindow().GetSize();
+        return { camPos, { camPos.x + static_cast<double>(winSize.x), camPos.y + static_cast<double>(winSize.y) } };
+    }
+
+    Math::vec2 halfExtent = { static_cast<double>(canvas_size.x) * 0.5 / fullMapScale, static_cast<double>(canvas_size.y) * 0.5 / fullMapScale };
+    return { fullMapCamPos - halfExtent, fullMapCamPos + halfExtent };
+}
+
 void MiniMap::DrawGrid(ImDrawList* draw_list, const ImVec2& canvas_min, const ImVec2& canvas_max) const
 {
     if (style.gridDivisions <= 1.0 || currentMode == MiniMapMode::Full)
@@ -374,9 +390,13 @@ void MiniMap::DrawTerrainPolygons(ImDrawList* draw_list, const ImVec2& canvas_mi
         return;
     ImVec2 canvas_size = ImVec2(canvas_max.x - canvas_min.x, canvas_max.y - canvas_min.y);
 
-    // Draw static map collision geometry as wireframes
-    for (const auto& poly : mapManager->GetMiniMapPolygons())
+    // Draw static map collision geometry as wireframes, skipping polygons outside the canvas
+    const auto&           polygons = mapManager->GetMiniMapPolygons();
+    std::vector<uint32_t> visiblePolygons;
+    mapManager->QueryMiniMapPolygons(VisibleWorldRect(canvas_size), visiblePolygons);
+    for (uint32_t index : visiblePolygons)
     {
+        const Polygon& poly = polygons[index];
         if (poly.vertices.size() < 2)
             continue;
         for (size_t i = 0; i < poly.vertices.size(); ++i)
@@ -397,43 +417,48 @@ void MiniMap::DrawGameObjects(ImDrawList* draw_list, const ImVec2& canvas_min, c
         return;
     ImVec2 canvas_size = ImVec2(canvas_max.x - canvas_min.x, canvas_max.y - canvas_min.y);
 
-    for (CS230::GameObject* obj : gameObjectManager->GetObjects())
+    for (size_t typeIndex = 0; typeIndex < GameObjectTypeSlots; ++typeIndex)
     {
+        const GameObjectTypes type = static_cast<GameObjectTypes>(typeIndex);
+
         // Exclude specific types from appearing on the map
-        if (obj->Type() == GameObjectTypes::Player || obj->Type() == GameObjectTypes::Floor || obj->Type() == GameObjectTypes::Particle)
+        if (type == GameObjectTypes::Player || type == GameObjectTypes::Floor || type == GameObjectTypes::Particle || type == GameObjectTypes::Count)
             continue;
 
-        // Skip rendering objects hidden by fog of war
-        if (currentMode == MiniMapMode::Full && style.enableFog && !fogVisited.empty())
+        for (CS230::GameObject* obj : gameObjectManager->GetObjectsOfType(type))
         {
-            int gridX = static_cast<int>((obj->GetPosition().x - worldBounds.Left()) / style.fogTileSize);
-            int gridY = static_cast<int>((obj->GetPosition().y - worldBounds.Bottom()) / style.fogTileSize);
-
-            if (gridY >= 0 && gridY < fogRows && gridX >= 0 && gridX < fogCols)
+            // Skip rendering objects hidden by fog of war
+            if (currentMode == MiniMapMode::Full && style.enableFog && !fogVisited.empty())
             {
-                if (!fogVisited[static_cast<size_t>(gridY)][static_cast<size_t>(gridX)])
-                    continue;
+                int gridX = static_cast<int>((obj->GetPosition().x - worldBounds.Left()) / style.fogTileSize);
+                int gridY = static_cast<int>((obj->GetPosition().y - worldBounds.Bottom()) / style.fogTileSize);
+
+                if (gridY >= 0 && gridY < fogRows && gridX >= 0 && gridX < fogCols)
+                {
+                    if (!fogVisited[static_cast<size_t>(gridY)][static_cast<size_t>(gridX)])
+                        continue;
+                }
             }
-        }
 
-        Math::vec2 pos = WorldToMapCanvas(obj->GetPosition(), canvas_size);
-        float      px  = canvas_min.x + static_cast<float>(pos.x);
-        float      py  = canvas_min.y + static_cast<float>(pos.y);
+            Math::vec2 pos = WorldToMapCanvas(obj->GetPosition(), canvas_size);
+            float      px  = canvas_min.x + static_cast<float>(pos.x);
+            float      py  = canvas_min.y + static_cast<float>(pos.y);
 
-        if (px < canvas_min.x || px > canvas_max.x || py < canvas_min.y || py > canvas_max.y)
-            continue;
+            if (px < canvas_min.x || px > canvas_max.x || py < canvas_min.y || py > canvas_max.y)
+                continue;
 
-        // Represent different game object types with unique shapes/colors
-        switch (obj->Type())
-        {
-            case GameObjectTypes::Bonfire: draw_list->AddTriangleFilled(ImVec2(px, py - 4), ImVec2(px - 4, py + 4), ImVec2(px + 4, py + 4), IM_COL32(255, 140, 0, 255)); break;
-            case GameObjectTypes::Door: draw_list->AddRectFilled(ImVec2(px - 3, py - 5), ImVec2(px + 3, py + 5), IM_COL32(139, 69, 19, 255)); break;
-            case GameObjectTypes::Mirror:
-            case GameObjectTypes::PushableMirror: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(0, 255, 255, 255)); break;
-            case GameObjectTypes::Star: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(255, 0, 0, 255)); break;
-            case GameObjectTypes::Target: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(255, 215, 0, 255)); break;
-            case GameObjectTypes::Sign: draw_list->AddCircleFilled(ImVec2(px, py), 2.0f, IM_COL32(200, 200, 200, 255)); break;
-            default: draw_list->AddCircleFilled(ImVec2(px, py), 2.0f, IM_COL32(255, 255, 255, 255)); break;
+            // Represent different game object types with unique shapes/colors
+            switch (type)
+            {
+                case GameObjectTypes::Bonfire: draw_list->AddTriangleFilled(ImVec2(px, py - 4), ImVec2(px - 4, py + 4), ImVec2(px + 4, py + 4), IM_COL32(255, 140, 0, 255)); break;
+                case GameObjectTypes::Door: draw_list->AddRectFilled(ImVec2(px - 3, py - 5), ImVec2(px + 3, py + 5), IM_COL32(139, 69, 19, 255)); break;
+                case GameObjectTypes::Mirror:
+                case GameObjectTypes::PushableMirror: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(0, 255, 255, 255)); break;
+                case GameObjectTypes::Star: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(255, 0, 0, 255)); break;
+                case GameObjectTypes::Target: draw_list->AddCircleFilled(ImVec2(px, py), 3.0f, IM_COL32(255, 215, 0, 255)); break;
+                case GameObjectTypes::Sign: draw_list->AddCircleFilled(ImVec2(px, py), 2.0f, IM_COL32(200, 200, 200, 255)); break;
+                default: draw_list->AddCircleFilled(ImVec2(px, py), 2.0f, IM_COL32(255, 255, 255, 255)); break;
+            }
         }
     }
 }
@@ -71,6 +71,8 @@ public:
 private:
     // Internal coordinate transformation: World Space -> UI Canvas Space
     Math::vec2 WorldToMapCanvas(const Math::vec2& world_position, const struct ImVec2& canvas_size) const;
+    // World-space area covered by the canvas in the current mode (inverse of WorldToMapCanvas)
+    Math::rect VisibleWorldRect(const struct ImVec2& canvas_size) const;
 
     // Layered rendering helper methods
     void DrawGrid(struct ImDrawList* draw_list, const struct ImVec2& canvas_min, const struct ImVec2& canvas_max) const;
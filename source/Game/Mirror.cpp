@@ -16,7 +16,7 @@ Mirror::Mirror(Math::vec2 in_position, Math::vec2 in_size, float in_rotation) :
 void Mirror::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     auto&                      renderer  = Engine::GetRenderer2D();
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(size);
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(size);
 
     // Render the structural base of the mirror
     renderer.DrawRectangle(transform, 0x00FFFF80, CS200::WHITE, 2.0);
@@ -26,7 +26,7 @@ void Mirror::Draw(const Math::TransformationMatrix& camera_matrix)
     Math::vec2 p1   = { -half.x, 0 };
     Math::vec2 p2   = { half.x, 0 };
 
-    renderer.DrawLine(GetMatrix(), p1, p2, 0x00FFFFFF, 3.0);
+    renderer.DrawLine(GetRenderMatrix(), p1, p2, 0x00FFFFFF, 3.0);
 
     CS230::GameObject::Draw(camera_matrix);
 }
@@ -44,4 +44,9 @@ Physics::LineSegment Mirror::GetReflectiveSegment()
     Math::vec2 worldP2 = mat * p2;
 
     return { worldP1, worldP2, true };
+}
+
+void Mirror::AppendLaserSegments(std::vector<Physics::LineSegment>& out)
+{
+    out.push_back(GetReflectiveSegment());
 }
\ No newline at end of file
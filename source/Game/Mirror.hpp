@@ -21,6 +21,7 @@ public:
 
     // Returns the world-space segment used for reflecting laser beams
     Physics::LineSegment GetReflectiveSegment();
+    void                 AppendLaserSegments(std::vector<Physics::LineSegment>& out) override;
 
 private:
     Math::vec2 size;
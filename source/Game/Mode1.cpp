@@ -2,6 +2,7 @@
 
 #include "Door.hpp"
 #include "DoorActionHandler.hpp"
+#include "LaserBatch.hpp"
 #include "MainMenu.hpp"
 #include "MiniMap.hpp"
 #include "ObjectFactory.hpp"
@@ -34,6 +35,7 @@ void Mode1::Load()
     Engine::GetGameStateManager().HoldFadeIn(true);
 
     AddGSComponent(new CS230::GameObjectManager());
+    AddGSComponent(new LaserBatch());
 
     player = new Player({ 0.0, 400.0 });
 
@@ -67,6 +69,8 @@ void Mode1::Load()
     AddGSComponent(mapManager);
 
     backgroundShader                = OpenGL::CreateShader(std::filesystem::path("Assets/shaders/Cradle.vert"), std::filesystem::path("Assets/shaders/Cradle.frag"));
+    bgResolutionUniform             = OpenGL::GetUniform(backgroundShader, "u_resolution");
+    bgTimeUniform                   = OpenGL::GetUniform(backgroundShader, "u_time");
     std::vector<float> quadVertices = { -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f };
     backgroundVBO                   = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, std::as_bytes(std::span{ quadVertices }));
     OpenGL::VertexBuffer vb;
@@ -135,6 +139,7 @@ void Mode1::Update(double dt)
 
     auto gom = GetGSComponent<CS230::GameObjectManager>();
     gom->UpdateAll(dt);
+    GetGSComponent<LaserBatch>()->Resolve();
     gom->CollisionTest();
 
     if (player != nullptr && player->isInteracting && player->interactionTarget != nullptr)
@@ -175,7 +180,7 @@ void Mode1::Update(double dt)
 
     if (Engine::GetInput().KeyJustPressed(CS230::Input::Keys::P))
     {
-        player->SetPosition({ 3200, -700 });
+        player->Teleport({ 3200, -700 });
     }
 }
 
@@ -204,10 +209,8 @@ void Mode1::Draw()
     postProcessor.BeginSceneRender();
     {
         GL::UseProgram(backgroundShader.Shader);
-        GLint resLoc  = GL::GetUniformLocation(backgroundShader.Shader, "u_resolution");
-        GLint timeLoc = GL::GetUniformLocation(backgroundShader.Shader, "u_time");
-        GL::Uniform2f(resLoc, static_cast<float>(display_size_int.x), static_cast<float>(display_size_int.y));
-        GL::Uniform1f(timeLoc, static_cast<float>(shaderTime));
+        GL::Uniform2f(bgResolutionUniform.Location, static_cast<float>(display_size_int.x), static_cast<float>(display_size_int.y));
+        GL::Uniform1f(bgTimeUniform.Location, static_cast<float>(shaderTime));
         GL::BindVertexArray(backgroundVAO);
         GL::DrawArrays(GL_TRIANGLE_FAN, 0, 4);
         GL::BindVertexArray(0);
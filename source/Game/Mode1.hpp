@@ -66,6 +66,8 @@ private:
 
     // Background Shader Members
     OpenGL::CompiledShader    backgroundShader;
+    OpenGL::UniformHandle     bgResolutionUniform;
+    OpenGL::UniformHandle     bgTimeUniform;
     OpenGL::VertexArrayHandle backgroundVAO;
     OpenGL::BufferHandle      backgroundVBO;
     double                    shaderTime = 0.0;
@@ -11,6 +11,7 @@
 #include "DoorActionHandler.hpp"
 #include "Gate.hpp"
 #include "InGameScriptEditor.hpp"
+#include "LaserBatch.hpp"
 #include "LevelStreamer.hpp"
 #include "LightOrb.hpp"
 #include "LightOrbManager.hpp"
@@ -300,6 +301,7 @@ void Mode3::Load()
     Engine::GetGameStateManager().HoldFadeIn(true);
 
     AddGSComponent(new CS230::GameObjectManager());
+    AddGSComponent(new LaserBatch());
 
     spawnPos = LoadEditorSpawnMarker().value_or(Math::vec2{ -10.0, 0.0 });
 
@@ -352,17 +354,24 @@ void Mode3::Load()
     mapManager->LoadMap();
     AddGSComponent(mapManager);
 
-    backgroundShader = OpenGL::CreateShader(std::filesystem::path("Assets/shaders/Cradle.vert"), std::filesystem::path("Assets/shaders/Cradle.frag"));
+    if (!Engine::IsHeadless())
+    {
+        backgroundShader    = OpenGL::CreateShader(std::filesystem::path("Assets/shaders/Cradle.vert"), std::filesystem::path("Assets/shaders/Cradle.frag"));
+        bgResolutionUniform = OpenGL::GetUniform(backgroundShader, "u_resolution");
+        bgTimeUniform       = OpenGL::GetUniform(backgroundShader, "u_time");
+        bgCamPosUniform     = OpenGL::GetUniform(backgroundShader, "u_camPos");
+        bgParallaxUniform   = OpenGL::GetUniform(backgroundShader, "u_parallax");
 
-    std::vector<float> quadVertices = { -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f };
+        std::vector<float> quadVertices = { -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f };
 
-    backgroundVBO = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, std::as_bytes(std::span{ quadVertices }));
+        backgroundVBO = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, std::as_bytes(std::span{ quadVertices }));
 
-    OpenGL::VertexBuffer vb;
-    vb.Handle = backgroundVBO;
-    vb.Layout = OpenGL::BufferLayout({ OpenGL::Attribute::Float2, OpenGL::Attribute::Float2 });
+        OpenGL::VertexBuffer vb;
+        vb.Handle = backgroundVBO;
+        vb.Layout = OpenGL::BufferLayout({ OpenGL::Attribute::Float2, OpenGL::Attribute::Float2 });
 
-    backgroundVAO = OpenGL::CreateVertexArrayObject({ vb });
+        backgroundVAO = OpenGL::CreateVertexArrayObject({ vb });
+    }
 
     miniMap = new MiniMap();
     miniMap->SetWorldBounds(level_boundary);
@@ -468,7 +477,7 @@ void Mode3::InitGame()
 
     // Level streaming: assign objects to rooms, start with all active
     levelStreamer = new LevelStreamer();
-    levelStreamer->Init(mapManager->GetAllRooms(), gom->GetObjects());
+    levelStreamer->Init(mapManager->GetAllRooms(), gom);
 
     // Apply saved game state (abilities, HP, gate states)
     if (SaveManager::HasSave())
@@ -521,8 +530,7 @@ void Mode3::Update(double dt)
 #ifdef DEVELOPER_VERSION
     // Tab: switch to level editor (debug builds only)
     {
-        const Uint8* sdlKeys = SDL_GetKeyboardState(nullptr);
-        if (sdlKeys[SDL_SCANCODE_TAB])
+        if (Engine::GetInput().KeyDown(CS230::Input::Keys::Tab))
         {
             const Math::vec2 playerPos = player ? player->GetPosition() : Math::vec2{ 300.0, -3000.0 };
             LevelEditor::SetGameObjects(GetGSComponent<CS230::GameObjectManager>());
@@ -542,11 +550,8 @@ void Mode3::Update(double dt)
         BashTargetKind nearestKind   = BashTargetKind::None;
         double         nearestDist   = BASH_RADIUS * BASH_RADIUS;
 
-        for (auto* obj : GetGSComponent<CS230::GameObjectManager>()->GetObjects())
+        for (auto* obj : GetGSComponent<CS230::GameObjectManager>()->GetObjectsOfType(GameObjectTypes::LaserTurret))
         {
-            if (obj->Type() != GameObjectTypes::LaserTurret)
-                continue;
-
             auto* turret = static_cast<LaserTurret*>(obj);
 
             for (const Math::vec2 bulletPos : turret->GetBashableBulletPositions())
@@ -751,16 +756,12 @@ void Mode3::Update(double dt)
                 if (player->GetPosition().x >= 16200.0)
                 {
                     BreakableWall* entranceWall = nullptr;
-                    for (auto* obj : gom->GetObjects())
+                    for (auto* obj : gom->GetObjectsOfType(GameObjectTypes::BreakableWall))
                     {
-                        if (obj && obj->Type() == GameObjectTypes::BreakableWall)
+                        if (obj->GetName() == "BOSS_ENTRANCE")
                         {
-                            auto* bw = static_cast<BreakableWall*>(obj);
-                            if (bw->GetName() == "BOSS_ENTRANCE")
-                            {
-                                entranceWall = bw;
-                                break;
-                            }
+                            entranceWall = static_cast<BreakableWall*>(obj);
+                            break;
                         }
                     }
                     if (entranceWall)
@@ -797,6 +798,7 @@ void Mode3::Update(double dt)
         const double freezeMult = (cutscenePlayer && cutscenePlayer->IsTimeFrozen()) ? 0.0 : 1.0;
         const double scaledDt   = dt * timeScale * freezeMult;
         GetGSComponent<CS230::GameObjectManager>()->UpdateAll(scaledDt);
+        GetGSComponent<LaserBatch>()->Resolve();
         GetGSComponent<CS230::GameObjectManager>()->CollisionTest();
     }
 
@@ -921,7 +923,7 @@ void Mode3::Update(double dt)
         // Smooth lerp — no teleport
         constexpr double CAM_SPEED = 8.0;
         const Math::vec2 cur       = camera->GetPosition();
-        camera->SetPosition(cur + (target - cur) * std::min(dt * CAM_SPEED, 1.0));
+        camera->MoveTo(cur + (target - cur) * std::min(dt * CAM_SPEED, 1.0));
     }
 
     // Pass player HP and camera position to post-processor
@@ -960,7 +962,7 @@ void Mode3::Update(double dt)
                 const Math::vec2 respawnPos = player->GetSavePoint();
                 spawnPos                    = respawnPos;
                 player->ResetState();
-                player->SetPosition(respawnPos);
+                player->Teleport(respawnPos);
                 // Tutorial runs once: if it had started, skip it permanently
                 if (parryTut.state != ParryTutState::Idle && parryTut.state != ParryTutState::Done)
                     parryTut.state = ParryTutState::Done;
@@ -972,9 +974,7 @@ void Mode3::Update(double dt)
                 player->inputLocked = false;
 
                 // Reset broken water walls
-                for (auto* obj : GetGSComponent<CS230::GameObjectManager>()->GetObjects())
-                    if (obj && obj->Type() == GameObjectTypes::BreakableWall)
-                        static_cast<BreakableWall*>(obj)->ResetIfWater();
+                GetGSComponent<CS230::GameObjectManager>()->ForEach<BreakableWall>(GameObjectTypes::BreakableWall, [](BreakableWall* wall) { wall->ResetIfWater(); });
 
                 // Snap camera to spawn position while screen is black
                 if (camera)
@@ -1047,8 +1047,8 @@ void Mode3::Draw()
         return;
     }
 
-    // Snap camera position to nearest pixel to eliminate sub-pixel jitter
-    const Math::vec2           rawCamPos  = camera->GetPosition();
+    // Interpolate like every object does, then snap to the nearest pixel to eliminate sub-pixel jitter
+    const Math::vec2           rawCamPos  = camera->GetRenderPosition();
     const Math::vec2           snapCamPos = { std::round(rawCamPos.x), std::round(rawCamPos.y) };
     Math::TransformationMatrix vp         = CS200::build_ndc_matrix(display_size_int) * (Math::ScaleMatrix({ camera->GetScale(), camera->GetScale() }) * Math::TranslationMatrix(-snapCamPos));
 
@@ -1056,14 +1056,13 @@ void Mode3::Draw()
     postProcessor.BeginSceneRender();
     {
         GL::UseProgram(backgroundShader.Shader);
-        GL::Uniform2f(GL::GetUniformLocation(backgroundShader.Shader, "u_resolution"), static_cast<float>(display_size_int.x), static_cast<float>(display_size_int.y));
-        GL::Uniform1f(GL::GetUniformLocation(backgroundShader.Shader, "u_time"), static_cast<float>(shaderTime));
+        GL::Uniform2f(bgResolutionUniform.Location, static_cast<float>(display_size_int.x), static_cast<float>(display_size_int.y));
+        GL::Uniform1f(bgTimeUniform.Location, static_cast<float>(shaderTime));
         if (camera)
         {
-            const Math::vec2 cp = camera->GetPosition();
-            GL::Uniform2f(GL::GetUniformLocation(backgroundShader.Shader, "u_camPos"), static_cast<float>(cp.x), static_cast<float>(cp.y));
+            GL::Uniform2f(bgCamPosUniform.Location, static_cast<float>(rawCamPos.x), static_cast<float>(rawCamPos.y));
         }
-        GL::Uniform1f(GL::GetUniformLocation(backgroundShader.Shader, "u_parallax"), 0.25f);
+        GL::Uniform1f(bgParallaxUniform.Location, 0.25f);
         GL::BindVertexArray(backgroundVAO);
         GL::DrawArrays(GL_TRIANGLE_FAN, 0, 4);
         GL::BindVertexArray(0);
@@ -1080,11 +1079,8 @@ void Mode3::Draw()
         auto* gom = GetGSComponent<CS230::GameObjectManager>();
         if (gom)
         {
-            for (auto* obj : gom->GetObjects())
+            for (auto* obj : gom->GetObjectsOfType(GameObjectTypes::LaserTurret))
             {
-                if (obj->Type() != GameObjectTypes::LaserTurret)
-                    continue;
-
                 auto* turret = static_cast<LaserTurret*>(obj);
                 if (!turret->IsBulletActive() || turret->IsBulletBashed())
                     continue;
@@ -1193,12 +1189,57 @@ void Mode3::DrawImGui()
     if (ImGui::CollapsingHeader("Global Info", ImGuiTreeNodeFlags_DefaultOpen))
     {
         ImGui::Text("FPS: %d", Engine::GetWindowEnvironment().FPS);
+        ImGui::Text("Draw calls: %llu", static_cast<unsigned long long>(Engine::GetWindowEnvironment().DrawCalls));
+        ImGui::Text(
+            "GL state calls: %llu issued, %llu elided", static_cast<unsigned long long>(Engine::GetWindowEnvironment().GLStateCallsIssued),
+            static_cast<unsigned long long>(Engine::GetWindowEnvironment().GLStateCallsElided));
         if (camera)
         {
             Math::vec2 camPos = camera->GetPosition();
             ImGui::Text("Camera Pos: (%.1f, %.1f)", camPos.x, camPos.y);
         }
     }
+    if (ImGui::CollapsingHeader("Collision Broad Phase"))
+    {
+        auto gom = GetGSComponent<CS230::GameObjectManager>();
+        if (gom)
+        {
+            const CS230::GameObjectManager::CollisionStats& stats = gom->GetCollisionStats();
+            ImGui::Text("Colliders: %d (passive: %d)", stats.colliders, stats.passive_colliders);
+            ImGui::Text("Occupied Cells: %d", static_cast<int>(stats.occupied_cells));
+            ImGui::Text("Terrain BVH: %d elements, %d nodes", static_cast<int>(stats.terrain_elements), static_cast<int>(stats.terrain_nodes));
+            ImGui::Text("Brute Force Pairs: %lld", stats.brute_force_pairs);
+            ImGui::Text("Candidate Pairs: %lld", stats.candidate_pairs);
+            ImGui::Text("Pairs Tested: %lld", stats.pairs_tested);
+            ImGui::Text("Pairs Colliding: %lld", stats.pairs_colliding);
+        }
+    }
+    if (ImGui::CollapsingHeader("Collision Layers"))
+    {
+        auto gom = GetGSComponent<CS230::GameObjectManager>();
+        if (gom)
+        {
+            const CS230::CollisionMatrix& matrix = gom->GetCollisionMatrix();
+            for (size_t a = 0; a < GameObjectTypeSlots; ++a)
+            {
+                const GameObjectTypes type = static_cast<GameObjectTypes>(a);
+                if (matrix.IsPassive(type))
+                    continue;
+
+                std::string targets;
+                for (size_t b = 0; b < GameObjectTypeSlots; ++b)
+                {
+                    if (!matrix.CanPair(type, static_cast<GameObjectTypes>(b)))
+                        continue;
+                    if (!targets.empty())
+                        targets += ", ";
+                    targets += CS230::GetTypeName(static_cast<GameObjectTypes>(b));
+                }
+                ImGui::Text("%s -> %s", CS230::GetTypeName(type), targets.c_str());
+            }
+            ImGui::TextDisabled("All other types are passive and never start a pair test.");
+        }
+    }
     if (ImGui::CollapsingHeader("Object Inspector", ImGuiTreeNodeFlags_DefaultOpen))
     {
         auto gom = GetGSComponent<CS230::GameObjectManager>();
@@ -1305,10 +1346,8 @@ void Mode3::SaveGame()
     auto* gom = GetGSComponent<CS230::GameObjectManager>();
     if (gom)
     {
-        for (auto* obj : gom->GetObjects())
+        for (auto* obj : gom->GetObjectsOfType(GameObjectTypes::Gate))
         {
-            if (obj->Type() != GameObjectTypes::Gate)
-                continue;
             auto* gate = static_cast<Gate*>(obj);
             if (!gate->IsOpen())
                 continue;
@@ -1343,10 +1382,8 @@ void Mode3::ApplySave(const SaveData& data)
     auto* gom = GetGSComponent<CS230::GameObjectManager>();
     if (gom && !data.openGates.empty())
     {
-        for (auto* obj : gom->GetObjects())
+        for (auto* obj : gom->GetObjectsOfType(GameObjectTypes::Gate))
         {
-            if (obj->Type() != GameObjectTypes::Gate)
-                continue;
             auto* gate = static_cast<Gate*>(obj);
 
             std::string id = gate->GetName();
@@ -1372,9 +1409,12 @@ void Mode3::Unload()
 {
     AudioManager::StopBGM();
 
-    OpenGL::DestroyShader(backgroundShader);
-    GL::DeleteVertexArrays(1, &backgroundVAO);
-    GL::DeleteBuffers(1, &backgroundVBO);
+    if (!Engine::IsHeadless())
+    {
+        OpenGL::DestroyShader(backgroundShader);
+        GL::DeleteVertexArrays(1, &backgroundVAO);
+        GL::DeleteBuffers(1, &backgroundVBO);
+    }
 
     delete shieldChargeShot;
     shieldChargeShot = nullptr;
@@ -1418,14 +1458,7 @@ void Mode3::InitSimpleBossFight(CS230::GameObjectManager* gom)
 
     std::vector<TargetStar*> allTargets;
 
-    for (auto* obj : gom->GetObjects())
-    {
-        if (obj == nullptr || obj->Type() != GameObjectTypes::Target)
-            continue;
-
-        auto* target = static_cast<TargetStar*>(obj);
-        allTargets.push_back(target);
-    }
+    gom->ForEach<TargetStar>(GameObjectTypes::Target, [&allTargets](TargetStar* target) { allTargets.push_back(target); });
 
     const std::vector<Math::rect>& rooms = mapManager->GetAllRooms();
 
@@ -94,6 +94,10 @@ private:
     Boss::ShieldChargeShot* shieldChargeShot = nullptr;
 
     OpenGL::CompiledShader    backgroundShader;
+    OpenGL::UniformHandle     bgResolutionUniform;
+    OpenGL::UniformHandle     bgTimeUniform;
+    OpenGL::UniformHandle     bgCamPosUniform;
+    OpenGL::UniformHandle     bgParallaxUniform;
     OpenGL::VertexArrayHandle backgroundVAO;
     OpenGL::BufferHandle      backgroundVBO;
     double                    shaderTime = 0.0;
@@ -1,41 +1,78 @@
 #include "OriAnim.hpp"
-#include "OriAnimData.hpp"
 
 #include "Engine/Engine.hpp"
+#include "Engine/Logger.hpp"
 #include "Engine/Matrix.hpp"
+#include "Engine/Path.hpp"
 #include "Engine/TextureManager.hpp"
 #include <algorithm>
+#include <fstream>
+#include <sstream>
 
+// Written by tools/AtlasPacker from Assets/ori/clips.txt (the ori_atlas build target)
+#define ATLAS_DIR   "Assets/ori/atlas/"
+#define ATLAS_INDEX ATLAS_DIR "ori.txt"
+
+// Format: ATLAS <png> <w> <h> | CLIP <name> <fps> <loop> <scale> | FRAME <atlas> <x> <y> <w> <h>
 void OriAnimation::Build() {
     auto& texMgr = Engine::GetTextureManager();
 
-    for (const auto& cd : ANIM_CLIPS) {
-        OriClip clip;
-        clip.name = cd.name;
-        clip.fps  = cd.fps;
-        clip.loop = cd.loop;
-
-        if      (cd.name == std::string("run"))        clip.scale = 1.5f;
-        else if (cd.name == std::string("jump"))       clip.scale = 1.5f;
-        else if (cd.name == std::string("doublejump")) clip.scale = 1.5f;
-        else                                           clip.scale = 1.0f;
-
-        for (const auto& fd : cd.frames) {
-            auto tex = texMgr.Load(std::string(ATLAS_DIR) + fd.png);
-            if (!tex) continue;
-
-            OriFrame f;
-            f.texture  = tex;
-            f.texel    = { fd.x, fd.y };
-            f.crop     = { fd.w, fd.h };
-            f.displayW = static_cast<int>(fd.w / 2 * clip.scale);
-            f.displayH = static_cast<int>(fd.h / 2 * clip.scale);
-            clip.frames.push_back(std::move(f));
-        }
+    std::string path;
+    try { path = assets::locate_asset(ATLAS_INDEX).string(); }
+    catch (...) {
+        Engine::GetLogger().LogError(std::string("Missing ") + ATLAS_INDEX + ", build the ori_atlas target");
+        return;
+    }
+
+    std::ifstream f(path);
+    if (!f.is_open()) return;
 
-        if (!clip.frames.empty())
+    std::vector<std::shared_ptr<CS230::Texture>> atlases;
+    OriClip                                      clip;
+    bool                                         inClip = false;
+
+    auto finishClip = [&]() {
+        if (inClip && !clip.frames.empty())
             AddClip(std::move(clip));
+        clip   = OriClip{};
+        inClip = false;
+    };
+
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        std::string cmd;
+        ss >> cmd;
+
+        if (cmd == "ATLAS") {
+            std::string png;
+            ss >> png;
+            atlases.push_back(texMgr.Load(std::string(ATLAS_DIR) + png));
+        }
+        else if (cmd == "CLIP") {
+            finishClip();
+            int loop = 1;
+            ss >> clip.name >> clip.fps >> loop >> clip.scale;
+            clip.loop = (loop != 0);
+            inClip    = true;
+        }
+        else if (cmd == "FRAME" && inClip) {
+            size_t atlas = 0;
+            int    x = 0, y = 0, w = 0, h = 0;
+            ss >> atlas >> x >> y >> w >> h;
+            if (atlas >= atlases.size() || !atlases[atlas]) continue;
+
+            OriFrame fr;
+            fr.texture  = atlases[atlas];
+            fr.texel    = { x, y };
+            fr.crop     = { w, h };
+            fr.displayW = static_cast<int>(w / 2 * clip.scale);
+            fr.displayH = static_cast<int>(h / 2 * clip.scale);
+            clip.frames.push_back(std::move(fr));
+        }
     }
+    finishClip();
 
     Play("idle");
 }
@@ -1,201 +0,0 @@
-﻿#pragma once
-#include <vector>
-
-#define ATLAS_DIR "Assets/ori/"
-
-struct FrameData { const char* png; int x, y, w, h; bool flipped; };
-struct ClipData  { const char* name; float fps; bool loop; std::vector<FrameData> frames; };
-
-inline const std::vector<ClipData>& getAnimClips() {
-    static const std::vector<ClipData> CLIPS = {
-        { "idle", 30.0f, true, {
-            { "seinPlatformingAtlas0.png", 1453, 151, 89, 127, false },
-            { "seinPlatformingAtlas0.png", 1189, 258, 91, 128, false },
-            { "seinPlatformingAtlas0.png", 1167, 120, 92, 128, false },
-            { "seinPlatformingAtlas0.png", 1401, 1103, 93, 128, false },
-            { "seinPlatformingAtlas1.png", 2, 1790, 94, 126, false },
-            { "flipped/spirit_idle_0006.png", 0, 0, 95, 125, false },
-            { "seinPlatformingAtlas1.png", 377, 1795, 95, 123, false },
-            { "seinPlatformingAtlas1.png", 459, 896, 96, 122, false },
-            { "seinPlatformingAtlas1.png", 1061, 546, 95, 119, false },
-            { "seinPlatformingAtlas1.png", 1171, 428, 93, 119, false },
-            { "seinPlatformingAtlas2.png", 302, 1687, 91, 117, false },
-            { "seinPlatformingAtlas2.png", 796, 1570, 88, 116, false },
-            { "seinPlatformingAtlas0.png", 1835, 459, 87, 116, false },
-            { "seinPlatformingAtlas2.png", 1388, 381, 87, 115, false },
-            { "seinPlatformingAtlas2.png", 1822, 1932, 88, 114, false },
-            { "seinPlatformingAtlas2.png", 1317, 262, 89, 115, false },
-            { "seinPlatformingAtlas2.png", 1218, 500, 90, 115, false },
-            { "seinPlatformingAtlas2.png", 602, 1690, 91, 116, false },
-            { "seinPlatformingAtlas2.png", 695, 1930, 91, 116, false },
-            { "seinPlatformingAtlas1.png", 1956, 1273, 90, 117, false },
-            { "seinPlatformingAtlas2.png", 790, 1930, 89, 116, false },
-            { "seinPlatformingAtlas2.png", 302, 1445, 89, 117, false },
-            { "seinPlatformingAtlas1.png", 1741, 1316, 89, 118, false },
-            { "seinPlatformingAtlas2.png", 304, 1929, 90, 117, false },
-            { "seinPlatformingAtlas2.png", 1723, 1397, 91, 114, false },
-            { "flipped/spirit_idle_0026.png", 0, 0, 92, 114, false },
-            { "flipped/spirit_idle_0027.png", 0, 0, 93, 114, false },
-            { "seinPlatformingAtlas3.png", 513, 412, 94, 113, false },
-            { "seinPlatformingAtlas3.png", 513, 295, 94, 113, false },
-            { "seinPlatformingAtlas3.png", 314, 763, 96, 113, false },
-            { "seinPlatformingAtlas3.png", 213, 763, 97, 113, false },
-            { "seinPlatformingAtlas3.png", 213, 1348, 98, 113, false },
-            { "seinPlatformingAtlas2.png", 1124, 1217, 98, 115, false },
-            { "seinPlatformingAtlas1.png", 1480, 202, 96, 118, false },
-            { "seinPlatformingAtlas1.png", 748, 784, 95, 121, false },
-            { "seinPlatformingAtlas1.png", 667, 526, 93, 121, false },
-            { "seinPlatformingAtlas1.png", 473, 507, 90, 122, false },
-            { "seinPlatformingAtlas1.png", 190, 501, 90, 123, false },
-            { "seinPlatformingAtlas1.png", 375, 1922, 90, 124, false },
-            { "seinPlatformingAtlas1.png", 2, 1140, 89, 126, false },
-        }},
-        { "run", 30.0f, true, {
-            { "flipped/spirit_run_0000.png", 0, 0, 83, 73, false },
-            { "flipped/spirit_run_0001.png", 0, 0, 101, 71, false },
-            { "flipped/spirit_run_0002.png", 0, 0, 111, 69, false },
-            { "flipped/spirit_run_0003.png", 0, 0, 107, 75, false },
-            { "flipped/spirit_run_0004.png", 0, 0, 122, 79, false },
-            { "flipped/spirit_run_0005.png", 0, 0, 127, 80, false },
-            { "seinPlatformingAtlas5.png", 1510, 1245, 81, 79, false },
-            { "flipped/spirit_run_0007.png", 0, 0, 95, 75, false },
-            { "flipped/spirit_run_0008.png", 0, 0, 101, 71, false },
-            { "flipped/spirit_run_0009.png", 0, 0, 115, 70, false },
-            { "seinPlatformingAtlas0.png", 1105, 2, 122, 69, false },
-            { "flipped/spirit_run_0011.png", 0, 0, 84, 71, false },
-            { "seinPlatformingAtlas5.png", 391, 2, 99, 70, false },
-            { "flipped/spirit_run_0013.png", 0, 0, 107, 69, false },
-            { "flipped/spirit_run_0014.png", 0, 0, 106, 72, false },
-            { "flipped/spirit_run_0015.png", 0, 0, 108, 76, false },
-            { "flipped/spirit_run_0016.png", 0, 0, 117, 78, false },
-            { "flipped/spirit_run_0017.png", 0, 0, 125, 77, false },
-            { "flipped/spirit_run_0018.png", 0, 0, 90, 73, false },
-            { "seinPlatformingAtlas6.png", 1375, 1972, 87, 74, false },
-            { "flipped/spirit_run_0020.png", 0, 0, 82, 74, false },
-            { "flipped/spirit_run_0021.png", 0, 0, 82, 69, false },
-            { "flipped/spirit_run_0022.png", 0, 0, 84, 71, false },
-            { "seinPlatformingAtlas6.png", 1110, 1805, 92, 75, false },
-            { "seinPlatformingAtlas6.png", 1126, 1885, 87, 79, false },
-            { "seinPlatformingAtlas3.png", 1168, 2, 110, 75, false },
-            { "flipped/spirit_run_0028.png", 0, 0, 123, 71, false },
-            { "seinPlatformingAtlas2.png", 1733, 1622, 80, 70, false },
-            { "flipped/spirit_run_0030.png", 0, 0, 83, 69, false },
-            { "seinPlatformingAtlas6.png", 1138, 982, 85, 71, false },
-            { "seinPlatformingAtlas3.png", 953, 2, 101, 70, false },
-            { "flipped/spirit_run_0033.png", 0, 0, 110, 69, false },
-            { "flipped/spirit_run_0034.png", 0, 0, 105, 72, false },
-            { "flipped/spirit_run_0035.png", 0, 0, 127, 76, false },
-            { "flipped/spirit_run_0036.png", 0, 0, 128, 84, false },
-            { "seinPlatformingAtlas6.png", 1387, 1741, 81, 69, false },
-            { "flipped/spirit_run_0043.png", 0, 0, 83, 75, false },
-            { "flipped/spirit_run_0044.png", 0, 0, 84, 79, false },
-            { "flipped/spirit_run_0045.png", 0, 0, 94, 80, false },
-            { "flipped/spirit_run_0046.png", 0, 0, 104, 79, false },
-            { "flipped/spirit_run_0047.png", 0, 0, 108, 75, false },
-            { "seinPlatformingAtlas1.png", 1910, 853, 118, 71, false },
-            { "flipped/spirit_run_0049.png", 0, 0, 129, 70, false },
-            { "seinPlatformingAtlas6.png", 1296, 1655, 86, 69, false },
-            { "flipped/spirit_run_0051.png", 0, 0, 84, 71, false },
-            { "flipped/spirit_run_0052.png", 0, 0, 85, 70, false },
-            { "flipped/spirit_run_0053.png", 0, 0, 93, 69, false },
-            { "flipped/spirit_run_0054.png", 0, 0, 87, 72, false },
-            { "flipped/spirit_run_0055.png", 0, 0, 105, 75, false },
-            { "flipped/spirit_run_0056.png", 0, 0, 95, 77, false },
-            { "flipped/spirit_run_0057.png", 0, 0, 107, 75, false },
-            { "flipped/spirit_run_0058.png", 0, 0, 122, 72, false },
-            { "flipped/spirit_run_0059.png", 0, 0, 80, 73, false },
-        }},
-        { "jump", 30.0f, false, {
-            { "seinJumpingAtlas1.png", 957, 1134, 66, 76, false },
-            { "seinJumpingAtlas1.png", 583, 1748, 73, 78, false },
-            { "seinJumpingAtlas1.png", 431, 907, 83, 84, false },
-            { "seinJumpingAtlas1.png", 86, 781, 87, 88, false },
-            { "seinJumpingAtlas1.png", 181, 1176, 87, 87, false },
-            { "seinJumpingAtlas1.png", 340, 636, 82, 83, false },
-            { "flipped/jump_0007.png", 0, 0, 77, 82, false },
-            { "seinJumpingAtlas1.png", 428, 1810, 74, 79, false },
-            { "flipped/jump_0009.png", 0, 0, 72, 75, false },
-            { "seinJumpingAtlas1.png", 1131, 1481, 69, 71, false },
-            { "seinJumpingAtlas1.png", 1239, 1344, 67, 69, false },
-            { "seinJumpingAtlas1.png", 1297, 1521, 66, 70, false },
-            { "seinJumpingAtlas1.png", 1097, 1312, 67, 74, false },
-            { "seinJumpingAtlas1.png", 808, 1679, 70, 79, false },
-            { "seinJumpingAtlas1.png", 355, 1622, 72, 81, false },
-            { "flipped/jump_0016.png", 0, 0, 70, 83, false },
-            { "seinJumpingAtlas1.png", 529, 1217, 67, 83, false },
-            { "seinJumpingAtlas1.png", 596, 1325, 67, 83, false },
-            { "seinJumpingAtlas1.png", 662, 1668, 68, 83, false },
-            { "flipped/jump_0020.png", 0, 0, 69, 83, false },
-            { "seinJumpingAtlas1.png", 598, 305, 75, 84, false },
-            { "seinJumpingAtlas1.png", 600, 917, 79, 84, false },
-            { "seinJumpingAtlas1.png", 167, 117, 81, 85, false },
-            { "seinJumpingAtlas1.png", 249, 322, 80, 86, false },
-            { "seinJumpingAtlas1.png", 254, 422, 80, 86, false },
-            { "seinJumpingAtlas1.png", 518, 912, 78, 87, false },
-            { "flipped/jump_0027.png", 0, 0, 76, 87, false },
-        }},
-        { "fall", 30.0f, true, {
-            { "seinPlatformingAtlas4.png", 1207, 1154, 94, 108, false },
-            { "seinPlatformingAtlas4.png", 1142, 706, 93, 108, false },
-            { "seinPlatformingAtlas4.png", 512, 1937, 91, 109, false },
-            { "seinPlatformingAtlas4.png", 607, 1033, 88, 109, false },
-            { "seinPlatformingAtlas4.png", 1729, 387, 82, 107, false },
-            { "seinPlatformingAtlas5.png", 187, 620, 78, 106, false },
-            { "seinPlatformingAtlas5.png", 187, 510, 77, 106, false },
-            { "seinPlatformingAtlas4.png", 1158, 258, 81, 108, false },
-            { "seinPlatformingAtlas4.png", 1158, 370, 83, 108, false },
-            { "seinPlatformingAtlas4.png", 1640, 387, 85, 107, false },
-            { "seinPlatformingAtlas4.png", 1503, 1053, 88, 107, false },
-            { "seinPlatformingAtlas4.png", 414, 1711, 92, 109, false },
-            { "seinPlatformingAtlas4.png", 508, 1033, 95, 109, false },
-            { "seinPlatformingAtlas4.png", 1385, 1629, 97, 107, false },
-            { "seinPlatformingAtlas5.png", 206, 1723, 99, 105, false },
-            { "seinPlatformingAtlas4.png", 1628, 1297, 101, 106, false },
-            { "seinPlatformingAtlas2.png", 2, 2, 103, 108, false },
-            { "flipped/spirit_fall_0019.png", 0, 0, 102, 109, false },
-            { "seinPlatformingAtlas4.png", 973, 1714, 100, 108, false },
-            { "seinPlatformingAtlas5.png", 879, 93, 99, 104, false },
-            { "flipped/spirit_fall_0022.png", 0, 0, 96, 104, false },
-            { "seinPlatformingAtlas5.png", 856, 641, 92, 104, false },
-            { "seinPlatformingAtlas5.png", 499, 851, 88, 105, false },
-            { "seinPlatformingAtlas4.png", 1894, 1631, 82, 105, false },
-            { "seinPlatformingAtlas5.png", 659, 415, 80, 105, false },
-            { "seinPlatformingAtlas5.png", 187, 730, 79, 106, false },
-            { "seinPlatformingAtlas4.png", 1202, 146, 81, 108, false },
-            { "seinPlatformingAtlas4.png", 697, 1485, 85, 109, false },
-            { "seinPlatformingAtlas4.png", 604, 1259, 88, 109, false },
-            { "seinPlatformingAtlas4.png", 1156, 482, 91, 108, false },
-            { "seinPlatformingAtlas4.png", 1060, 482, 92, 108, false },
-            { "seinPlatformingAtlas4.png", 1406, 1518, 95, 107, false },
-            { "seinPlatformingAtlas4.png", 1486, 1629, 95, 107, false },
-            { "seinPlatformingAtlas4.png", 1108, 1154, 95, 108, false },
-            { "seinPlatformingAtlas4.png", 602, 920, 95, 109, false },
-            { "seinPlatformingAtlas4.png", 1060, 594, 94, 108, false },
-        }},
-        { "doublejump", 30.0f, false, {
-            { "seinJumpingAtlas1.png", 84, 206, 84, 87, false },
-            { "seinJumpingAtlas1.png", 975, 173, 80, 74, false },
-            { "seinJumpingAtlas0.png", 432, 4, 90, 62, false },
-            { "seinJumpingAtlas1.png", 1325, 11, 70, 58, false },
-            { "flipped/spirit_doubleJump_0006.png", 0, 0, 64, 57, false },
-            { "flipped/spirit_doubleJump_0007.png", 0, 0, 57, 54, false },
-            { "seinJumpingAtlas0.png", 1891, 16, 46, 51, false },
-            { "seinJumpingAtlas1.png", 1231, 940, 49, 49, false },
-            { "seinJumpingAtlas1.png", 1392, 362, 50, 50, false },
-            { "flipped/spirit_doubleJump_0011.png", 0, 0, 53, 47, false },
-            { "seinJumpingAtlas1.png", 1350, 416, 48, 53, false },
-            { "flipped/spirit_doubleJump_0013.png", 0, 0, 52, 47, false },
-            { "seinJumpingAtlas0.png", 1259, 402, 45, 51, false },
-            { "flipped/spirit_doubleJump_0015.png", 0, 0, 46, 43, false },
-            { "seinJumpingAtlas0.png", 1259, 353, 44, 45, false },
-            { "seinJumpingAtlas0.png", 1691, 186, 44, 45, false },
-            { "seinJumpingAtlas0.png", 1691, 140, 42, 42, false },
-            { "seinJumpingAtlas0.png", 2002, 736, 42, 43, false },
-            { "flipped/spirit_doubleJump_0020.png", 0, 0, 40, 39, false },
-            { "seinJumpingAtlas0.png", 803, 1057, 40, 40, false },
-        }},
-    };
-    return CLIPS;
-}
-
-#define ANIM_CLIPS getAnimClips()
@@ -1,4 +1,5 @@
 #include "OriMode.hpp"
+#include "LaserBatch.hpp"
 #include "Player.hpp"
 
 #include "CS200/IRenderer2D.hpp"
@@ -17,6 +18,7 @@
 
 void OriMode::Load() {
     AddGSComponent(new CS230::GameObjectManager());
+    AddGSComponent(new LaserBatch());
 
     player = new Player({ 400.0, -2400.0 });
 
@@ -61,6 +63,7 @@ void OriMode::Update(double dt) {
 
     auto* gom = GetGSComponent<CS230::GameObjectManager>();
     gom->UpdateAll(dt);
+    GetGSComponent<LaserBatch>()->Resolve();
     gom->CollisionTest();
 
     Math::ivec2 winSize     = Engine::GetWindow().GetSize();
@@ -109,34 +109,50 @@ void OriPostProcessor::use(const OpenGL::CompiledShader& s) const
     GL::UseProgram(s.Shader);
 }
 
-void OriPostProcessor::setf(const OpenGL::CompiledShader& s, const char* n, float v) const
+void OriPostProcessor::setf(Uniform u, float v) const
 {
-    GLint loc = GL::GetUniformLocation(s.Shader, n);
-    if (loc >= 0) GL::Uniform1f(loc, v);
+    if (u.IsValid()) GL::Uniform1f(u.Location, v);
 }
 
-void OriPostProcessor::setv2(const OpenGL::CompiledShader& s, const char* n, float x, float y) const
+void OriPostProcessor::setv2(Uniform u, float x, float y) const
 {
-    GLint loc = GL::GetUniformLocation(s.Shader, n);
-    if (loc >= 0) GL::Uniform2f(loc, x, y);
+    if (u.IsValid()) GL::Uniform2f(u.Location, x, y);
 }
 
-void OriPostProcessor::seti(const OpenGL::CompiledShader& s, const char* n, int v) const
+void OriPostProcessor::seti(Uniform u, int v) const
 {
-    GLint loc = GL::GetUniformLocation(s.Shader, n);
-    if (loc >= 0) GL::Uniform1i(loc, v);
+    if (u.IsValid()) GL::Uniform1i(u.Location, v);
 }
 
-void OriPostProcessor::bindTex(const OpenGL::CompiledShader& s, int slot,
-                                GLuint tex, const char* name) const
+void OriPostProcessor::bindTex(int slot, GLuint tex, Uniform sampler) const
 {
     GL::ActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(slot));
     GL::BindTexture(GL_TEXTURE_2D, tex);
-    if (name)
-    {
-        GLint loc = GL::GetUniformLocation(s.Shader, name);
-        if (loc >= 0) GL::Uniform1i(loc, slot);
-    }
+    if (sampler.IsValid()) GL::Uniform1i(sampler.Location, slot);
+}
+
+void OriPostProcessor::resolveUniforms()
+{
+    using OpenGL::GetUniform;
+
+    _uBright    = { GetUniform(_sBright, "u_scene"), GetUniform(_sBright, "u_threshold") };
+    _uBlur      = { GetUniform(_sBlur, "u_tex"), GetUniform(_sBlur, "u_texel_size"), GetUniform(_sBlur, "u_direction") };
+    _uUpsample  = { GetUniform(_sUpsample, "u_tex"), GetUniform(_sUpsample, "u_texel_size"), GetUniform(_sUpsample, "u_radius") };
+    _uGodRays   = { GetUniform(_sGodRays, "u_occlusion"), GetUniform(_sGodRays, "u_light_pos"),
+                    GetUniform(_sGodRays, "u_num_samples"), GetUniform(_sGodRays, "u_density"),
+                    GetUniform(_sGodRays, "u_weight"), GetUniform(_sGodRays, "u_decay"),
+                    GetUniform(_sGodRays, "u_exposure") };
+    _uComposite = { GetUniform(_sComposite, "u_scene"), GetUniform(_sComposite, "u_bloom"),
+                    GetUniform(_sComposite, "u_grain"), GetUniform(_sComposite, "u_bloom_intensity"),
+                    GetUniform(_sComposite, "u_contrast"), GetUniform(_sComposite, "u_brightness"),
+                    GetUniform(_sComposite, "u_bezier_r"), GetUniform(_sComposite, "u_bezier_g"),
+                    GetUniform(_sComposite, "u_bezier_b"), GetUniform(_sComposite, "u_desat"),
+                    GetUniform(_sComposite, "u_blur_strength"), GetUniform(_sComposite, "u_blur_dir"),
+                    GetUniform(_sComposite, "u_twirl_angle"), GetUniform(_sComposite, "u_twirl_center_radius"),
+                    GetUniform(_sComposite, "u_grain_offset_scale") };
+    _uBlit      = { GetUniform(_sBlit, "u_tex") };
+    _uVignette  = { GetUniform(_sVignette, "u_hp"), GetUniform(_sVignette, "u_max_hp"),
+                    GetUniform(_sVignette, "u_time"), GetUniform(_sVignette, "u_blackout") };
 }
 
 void OriPostProcessor::drawFs() const
@@ -154,6 +170,9 @@ void OriPostProcessor::Initialize(Math::ivec2 windowSize)
     _w = windowSize.x;
     _h = windowSize.y;
 
+    if (Engine::IsHeadless())
+        return;
+
     namespace fs = std::filesystem;
     const fs::path shaderDir = "Assets/shaders";
 
@@ -183,6 +202,8 @@ void main() { fragColor = vec4(texture(u_tex, v_uv).rgb, 1.0); })";
     _sVignette = OpenGL::CreateShader(shaderDir / "fullscreen.vert",
                                       shaderDir / "health_vignette.frag");
 
+    resolveUniforms();
+
     // Empty VAO for VAO-less fullscreen draws (uses gl_VertexID)
     GL::GenVertexArrays(1, &_fsVao);
 
@@ -192,6 +213,9 @@ void main() { fragColor = vec4(texture(u_tex, v_uv).rgb, 1.0); })";
 
 void OriPostProcessor::Shutdown()
 {
+    if (Engine::IsHeadless())
+        return;
+
     freeFbos();
 
     OpenGL::DestroyShader(_sBright);
@@ -226,28 +250,28 @@ void OriPostProcessor::EndRenderAndDraw()
     {
         _occFbo.bind();
         use(_sBright);
-        bindTex(_sBright, 0, _scene.tex, "u_scene");
-        setf(_sBright, "u_threshold", bloomThreshold * 1.8f); // tighter threshold for rays
+        bindTex(0, _scene.tex, _uBright.scene);
+        setf(_uBright.threshold, bloomThreshold * 1.8f); // tighter threshold for rays
         drawFs();
 
         // God Rays pass
         _raysFbo.bind();
         use(_sGodRays);
-        bindTex(_sGodRays, 0, _occFbo.tex, "u_occlusion");
-        setv2(_sGodRays, "u_light_pos", lightPosX, lightPosY);
-        seti (_sGodRays, "u_num_samples", raysSamples);
-        setf (_sGodRays, "u_density",  raysDensity);
-        setf (_sGodRays, "u_weight",   raysWeight);
-        setf (_sGodRays, "u_decay",    raysDecay);
-        setf (_sGodRays, "u_exposure", raysExposure);
+        bindTex(0, _occFbo.tex, _uGodRays.occlusion);
+        setv2(_uGodRays.lightPos,   lightPosX, lightPosY);
+        seti (_uGodRays.numSamples, raysSamples);
+        setf (_uGodRays.density,    raysDensity);
+        setf (_uGodRays.weight,     raysWeight);
+        setf (_uGodRays.decay,      raysDecay);
+        setf (_uGodRays.exposure,   raysExposure);
         drawFs();
     }
 
     // ── Step 2: Bloom — BrightPass scene → pyramid[0] ────────────────────────
     _bloomPyr[0].bind();
     use(_sBright);
-    bindTex(_sBright, 0, _scene.tex, "u_scene");
-    setf(_sBright, "u_threshold", bloomThreshold);
+    bindTex(0, _scene.tex, _uBright.scene);
+    setf(_uBright.threshold, bloomThreshold);
     drawFs();
 
     // ── Step 3: Bloom — Downsample + Gaussian blur ───────────────────────────
@@ -261,18 +285,18 @@ void OriPostProcessor::EndRenderAndDraw()
 
         // H pass: src → pong (same resolution as ping)
         const_cast<Fbo&>(pong).bind();
-        bindTex(_sBlur, 0, src.tex, "u_tex");
-        setv2(_sBlur, "u_texel_size", 1.0f / static_cast<float>(pong.w),
-                                       1.0f / static_cast<float>(pong.h));
-        setv2(_sBlur, "u_direction", 1.0f, 0.0f);
+        bindTex(0, src.tex, _uBlur.tex);
+        setv2(_uBlur.texelSize, 1.0f / static_cast<float>(pong.w),
+                                1.0f / static_cast<float>(pong.h));
+        setv2(_uBlur.direction, 1.0f, 0.0f);
         drawFs();
 
         // V pass: pong → ping
         const_cast<Fbo&>(ping).bind();
-        bindTex(_sBlur, 0, pong.tex, "u_tex");
-        setv2(_sBlur, "u_texel_size", 1.0f / static_cast<float>(ping.w),
-                                       1.0f / static_cast<float>(ping.h));
-        setv2(_sBlur, "u_direction", 0.0f, 1.0f);
+        bindTex(0, pong.tex, _uBlur.tex);
+        setv2(_uBlur.texelSize, 1.0f / static_cast<float>(ping.w),
+                                1.0f / static_cast<float>(ping.h));
+        setv2(_uBlur.direction, 0.0f, 1.0f);
         drawFs();
     }
 
@@ -284,11 +308,11 @@ void OriPostProcessor::EndRenderAndDraw()
     for (int i = iters - 1; i > 0; --i)
     {
         const_cast<Fbo&>(_bloomPyr[i - 1]).bind();
-        bindTex(_sUpsample, 0, _bloomPyr[i].tex, "u_tex");
-        setv2(_sUpsample, "u_texel_size",
+        bindTex(0, _bloomPyr[i].tex, _uUpsample.tex);
+        setv2(_uUpsample.texelSize,
               1.0f / static_cast<float>(_bloomPyr[i].w),
               1.0f / static_cast<float>(_bloomPyr[i].h));
-        setf(_sUpsample, "u_radius", 0.5f);
+        setf(_uUpsample.radius, 0.5f);
         drawFs();
     }
 
@@ -299,37 +323,32 @@ void OriPostProcessor::EndRenderAndDraw()
     GL::Viewport(0, 0, _w, _h);
     use(_sComposite);
 
-    bindTex(_sComposite, 0, _scene.tex,       "u_scene");
-    bindTex(_sComposite, 1, _bloomPyr[0].tex, "u_bloom");
-    bindTex(_sComposite, 2, _grainTex,        "u_grain");
+    bindTex(0, _scene.tex,       _uComposite.scene);
+    bindTex(1, _bloomPyr[0].tex, _uComposite.bloom);
+    bindTex(2, _grainTex,        _uComposite.grain);
 
-    setf (_sComposite, "u_bloom_intensity", bloomIntensity);
-    setf (_sComposite, "u_contrast",        contrast);
-    setf (_sComposite, "u_brightness",      brightness);
+    setf (_uComposite.bloomIntensity, bloomIntensity);
+    setf (_uComposite.contrast,       contrast);
+    setf (_uComposite.brightness,     brightness);
 
     // Identity bezier curves (linear passthrough)
-    GLint locR = GL::GetUniformLocation(_sComposite.Shader, "u_bezier_r");
-    GLint locG = GL::GetUniformLocation(_sComposite.Shader, "u_bezier_g");
-    GLint locB = GL::GetUniformLocation(_sComposite.Shader, "u_bezier_b");
     const float bezier[4] = { 0.0f, 0.33f, 0.66f, 1.0f };
-    if (locR >= 0) GL::Uniform4fv(locR, 1, bezier);
-    if (locG >= 0) GL::Uniform4fv(locG, 1, bezier);
-    if (locB >= 0) GL::Uniform4fv(locB, 1, bezier);
+    if (_uComposite.bezierR.IsValid()) GL::Uniform4fv(_uComposite.bezierR.Location, 1, bezier);
+    if (_uComposite.bezierG.IsValid()) GL::Uniform4fv(_uComposite.bezierG.Location, 1, bezier);
+    if (_uComposite.bezierB.IsValid()) GL::Uniform4fv(_uComposite.bezierB.Location, 1, bezier);
 
-    setf(_sComposite, "u_desat",          desaturation);
-    setf(_sComposite, "u_blur_strength",  0.0f);
-    setv2(_sComposite,"u_blur_dir",       1.0f, 0.0f);
-    setf(_sComposite, "u_twirl_angle",    0.0f);
+    setf(_uComposite.desat,         desaturation);
+    setf(_uComposite.blurStrength,  0.0f);
+    setv2(_uComposite.blurDir,      1.0f, 0.0f);
+    setf(_uComposite.twirlAngle,    0.0f);
 
-    GLint locTwirl = GL::GetUniformLocation(_sComposite.Shader, "u_twirl_center_radius");
-    if (locTwirl >= 0) GL::Uniform4f(locTwirl, 0.5f, 0.5f, 0.3f, 0.3f);
+    if (_uComposite.twirlCenterRadius.IsValid()) GL::Uniform4f(_uComposite.twirlCenterRadius.Location, 0.5f, 0.5f, 0.3f, 0.3f);
 
     // World-space grain: offset by camera position so grain moves with the world.
     // Dividing by resolution * scale anchors the grain pattern to world coordinates.
     const float grainOffX = _camX / (static_cast<float>(_w) / 10.0f);
     const float grainOffY = _camY / (static_cast<float>(_h) / 10.0f);
-    GLint locGrain = GL::GetUniformLocation(_sComposite.Shader, "u_grain_offset_scale");
-    if (locGrain >= 0) GL::Uniform4f(locGrain, grainOffX, grainOffY, 10.0f, 10.0f);
+    if (_uComposite.grainOffsetScale.IsValid()) GL::Uniform4f(_uComposite.grainOffsetScale.Location, grainOffX, grainOffY, 10.0f, 10.0f);
 
     drawFs();
 
@@ -340,7 +359,7 @@ void OriPostProcessor::EndRenderAndDraw()
         GL::BlendFunc(GL_ONE, GL_ONE);
 
         use(_sBlit);
-        bindTex(_sBlit, 0, _raysFbo.tex, "u_tex");
+        bindTex(0, _raysFbo.tex, _uBlit.tex);
         drawFs();
 
         GL::Disable(GL_BLEND);
@@ -353,10 +372,10 @@ void OriPostProcessor::EndRenderAndDraw()
         GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         use(_sVignette);
-        setf(_sVignette, "u_hp",       _playerHp);
-        setf(_sVignette, "u_max_hp",   _maxHp);
-        setf(_sVignette, "u_time",     _vigTime);
-        setf(_sVignette, "u_blackout", _blackout);
+        setf(_uVignette.hp,       _playerHp);
+        setf(_uVignette.maxHp,    _maxHp);
+        setf(_uVignette.time,     _vigTime);
+        setf(_uVignette.blackout, _blackout);
         drawFs();
 
         GL::Disable(GL_BLEND);
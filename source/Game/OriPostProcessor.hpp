@@ -67,6 +67,29 @@ private:
     OpenGL::CompiledShader _sBlit;     // simple passthrough for additive blit
     OpenGL::CompiledShader _sVignette; // health vignette overlay
 
+    // Uniform handles per pass, resolved once in Initialize()
+    using Uniform = OpenGL::UniformHandle;
+    struct BrightUniforms    { Uniform scene, threshold; };
+    struct BlurUniforms      { Uniform tex, texelSize, direction; };
+    struct UpsampleUniforms  { Uniform tex, texelSize, radius; };
+    struct GodRaysUniforms   { Uniform occlusion, lightPos, numSamples, density, weight, decay, exposure; };
+    struct CompositeUniforms {
+        Uniform scene, bloom, grain;
+        Uniform bloomIntensity, contrast, brightness;
+        Uniform bezierR, bezierG, bezierB;
+        Uniform desat, blurStrength, blurDir, twirlAngle, twirlCenterRadius, grainOffsetScale;
+    };
+    struct BlitUniforms      { Uniform tex; };
+    struct VignetteUniforms  { Uniform hp, maxHp, time, blackout; };
+
+    BrightUniforms    _uBright;
+    BlurUniforms      _uBlur;
+    UpsampleUniforms  _uUpsample;
+    GodRaysUniforms   _uGodRays;
+    CompositeUniforms _uComposite;
+    BlitUniforms      _uBlit;
+    VignetteUniforms  _uVignette;
+
     float _playerHp = 5.0f;
     float _maxHp    = 5.0f;
     float _vigTime  = 0.0f;
@@ -80,11 +103,12 @@ private:
     void allocFbos(int w, int h);
     void freeFbos();
     void genGrainTex();
+    void resolveUniforms();
 
     void use(const OpenGL::CompiledShader& s) const;
-    void setf (const OpenGL::CompiledShader& s, const char* n, float v) const;
-    void setv2(const OpenGL::CompiledShader& s, const char* n, float x, float y) const;
-    void seti (const OpenGL::CompiledShader& s, const char* n, int v) const;
-    void bindTex(const OpenGL::CompiledShader& s, int slot, GLuint tex, const char* name) const;
+    void setf (Uniform u, float v) const;
+    void setv2(Uniform u, float x, float y) const;
+    void seti (Uniform u, int v) const;
+    void bindTex(int slot, GLuint tex, Uniform sampler) const;
     void drawFs() const;
 };
@@ -35,7 +35,6 @@ namespace
     constexpr Math::vec2 SHIELD_COOLDOWN_BAR_OFFSET{ 0.0, 58.0 };
 
     constexpr double MAX_WALKABLE_SLOPE_ANGLE_DEG = 70.0;
-    constexpr double EDGE_NORMAL_SAMPLE_OFFSET    = 3.0;
     constexpr double TOP_EDGE_NORMAL_Y_MIN        = 0.25;
     constexpr double BOTTOM_EDGE_NORMAL_Y_MAX     = -0.25;
 
@@ -44,109 +43,31 @@ namespace
         return Math::TranslationMatrix(center) * Math::ScaleMatrix(size);
     }
 
-    bool PointInsidePolygon(const Polygon& polygon, Math::vec2 point)
+    bool IsWalkableTopEdge(const CS230::PolygonEdges::Edge& edge)
     {
-        bool        inside = false;
-        const auto& verts  = polygon.vertices;
-
-        if (verts.empty())
-        {
-            return false;
-        }
-
-        for (size_t i = 0, j = verts.size() - 1; i < verts.size(); j = i++)
-        {
-            const Math::vec2 vi = verts[i];
-            const Math::vec2 vj = verts[j];
-
-            const bool intersect = ((vi.y > point.y) != (vj.y > point.y)) && (point.x < (vj.x - vi.x) * (point.y - vi.y) / ((vj.y - vi.y) + 0.000001) + vi.x);
-
-            if (intersect)
-            {
-                inside = !inside;
-            }
-        }
-
-        return inside;
-    }
-
-    Math::vec2 GetEdgeOutwardNormal(const Polygon& polygon, Math::vec2 p1, Math::vec2 p2)
-    {
-        constexpr double EDGE_EPS = 0.000001;
-
-        const Math::vec2 edge = p2 - p1;
-
-        Math::vec2 normal{ -edge.y, edge.x };
-
-        const double normal_length_sq = normal.LengthSquared();
-
-        if (normal_length_sq < EDGE_EPS)
-        {
-            return { 0.0, 0.0 };
-        }
-
-        normal = normal * (1.0 / std::sqrt(normal_length_sq));
-
-        const Math::vec2 mid{ (p1.x + p2.x) * 0.5, (p1.y + p2.y) * 0.5 };
-
-        const bool plus_inside  = PointInsidePolygon(polygon, mid + normal * EDGE_NORMAL_SAMPLE_OFFSET);
-        const bool minus_inside = PointInsidePolygon(polygon, mid - normal * EDGE_NORMAL_SAMPLE_OFFSET);
-
-        // If +normal side is inside and -normal side is outside,
-        // then normal points inward, so flip it.
-        if (plus_inside && !minus_inside)
-        {
-            normal = normal * -1.0;
-        }
-        else if (plus_inside == minus_inside)
-        {
-            // Unreliable edge classification.
-            // This can happen near complex concave regions or tiny edges.
-            return { 0.0, 0.0 };
-        }
-
-        return normal;
-    }
-
-    bool IsWalkableTopEdge(const Polygon& polygon, Math::vec2 p1, Math::vec2 p2)
-    {
-        const Math::vec2 outward = GetEdgeOutwardNormal(polygon, p1, p2);
-
         // A top/walkable edge has its outside direction mostly upward.
-        return outward.y > TOP_EDGE_NORMAL_Y_MIN;
+        return edge.outward.y > TOP_EDGE_NORMAL_Y_MIN;
     }
 
-    bool IsBlockingBottomEdge(const Polygon& polygon, Math::vec2 p1, Math::vec2 p2)
+    bool IsBlockingBottomEdge(const CS230::PolygonEdges::Edge& edge)
     {
-        const Math::vec2 outward = GetEdgeOutwardNormal(polygon, p1, p2);
-
         // A bottom/ceiling edge has its outside direction mostly downward.
-        return outward.y < BOTTOM_EDGE_NORMAL_Y_MAX;
+        return edge.outward.y < BOTTOM_EDGE_NORMAL_Y_MAX;
     }
 
-    double GetEdgeAngleDegrees(Math::vec2 p1, Math::vec2 p2)
+    bool IsWalkableSlopeEdge(const CS230::PolygonEdges::Edge& edge)
     {
-        const double dx = p2.x - p1.x;
-        const double dy = p2.y - p1.y;
-
-        if (std::abs(dx) < 0.000001 && std::abs(dy) < 0.000001)
-        {
-            return 0.0;
-        }
-
-        return std::atan2(std::abs(dy), std::abs(dx)) * 180.0 / PI;
+        return IsWalkableTopEdge(edge) && edge.angle_degrees <= MAX_WALKABLE_SLOPE_ANGLE_DEG;
     }
 
-    bool IsWalkableSlopeEdge(const Polygon& polygon, Math::vec2 p1, Math::vec2 p2)
+    // Box the resolvers query the edge table with; pad keeps edges that sit exactly on a pass's tolerance
+    Math::rect EdgeQueryBox(double left, double bottom, double right, double top)
     {
-        if (!IsWalkableTopEdge(polygon, p1, p2))
-        {
-            return false;
-        }
-
-        const double angle = GetEdgeAngleDegrees(p1, p2);
-
-        return angle <= MAX_WALKABLE_SLOPE_ANGLE_DEG;
+        constexpr double QUERY_PAD = 1.0;
+        return {
+            { std::min(left, right) - QUERY_PAD, std::min(bottom, top) - QUERY_PAD },
+            { std::max(left, right) + QUERY_PAD, std::max(bottom, top) + QUERY_PAD }
+        };
     }
 }
 
@@ -205,15 +126,16 @@ void Player::Update(double dt)
         auto* gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
         if (gom)
         {
-            for (auto* obj : gom->GetObjects())
+            // Any zone the body overlaps; a zone entirely above or below the player cannot submerge it
+            const Math::vec2 halfSize = PLAYER_COLLISION_SIZE * 0.5;
+            nearbyVolumes.clear();
+            gom->GetTriggerVolumes().QueryAABB({ GetPosition() - halfSize, GetPosition() + halfSize }, nearbyVolumes, CS230::TriggerVolumes::Layer(GameObjectTypes::Water));
+            for (auto* obj : nearbyVolumes)
             {
                 if (!obj->IsActive()) continue;
-                if (obj->Type() == GameObjectTypes::Water)
-                {
-                    auto* zone = static_cast<WaterZone*>(obj);
-                    double d = zone->GetSubmergedDepth(GetPosition().x, feetY);
-                    if (d > maxDepth) maxDepth = d;
-                }
+                auto* zone = static_cast<WaterZone*>(obj);
+                double d = zone->GetSubmergedDepth(GetPosition().x, feetY);
+                if (d > maxDepth) maxDepth = d;
             }
         }
         waterDepth = maxDepth;
@@ -444,7 +366,7 @@ void Player::HandleAutoMove(double dt)
 
 void Player::ResetState()
 {
-    SetPosition(startPosition);
+    Teleport(startPosition);
     previousPosition     = startPosition;
     velocityY            = 0.0;
     isJumping            = true;
@@ -702,9 +624,9 @@ void Player::HitWall(double wall_x, int direction)
     SetVelocity({ 0.0, GetVelocity().y });
 }
 
-bool Player::ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect& my_box, double prev_bottom)
+bool Player::ResolveFloorSurfaceSnap(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_bottom)
 {
-    if (floor_poly.vertexCount < 3 || velocityY > 0.0)
+    if (floor_edges.Size() < 3 || velocityY > 0.0)
     {
         return false;
     }
@@ -726,14 +648,18 @@ bool Player::ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect
     double surface_y           = 0.0;
     double surface_max_step_up = MAX_SURFACE_STEP_UP;
 
+    // Probes stay inside the box horizontally; a surface has to be within the snap-down, step-up or crossed range vertically
+    constexpr double MAX_DYNAMIC_STEP_UP = 24.0;
+    floor_edges.Query(EdgeQueryBox(my_box.Left() - SURFACE_X_MARGIN, current_bottom - SURFACE_CONTACT_TOLERANCE, my_box.Right() + SURFACE_X_MARGIN, std::max(prev_bottom, current_bottom + MAX_DYNAMIC_STEP_UP)), nearbyFloorEdges);
+
     auto try_probe_x = [&](double probe_x)
     {
-        const auto& verts = floor_poly.vertices;
-
-        for (size_t i = 0; i < verts.size(); ++i)
+        for (const uint32_t i : nearbyFloorEdges)
         {
-            Math::vec2 p1 = verts[i];
-            Math::vec2 p2 = verts[(i + 1) % verts.size()];
+            const CS230::PolygonEdges::Edge& edge = floor_edges[i];
+
+            const Math::vec2 p1 = edge.p1;
+            const Math::vec2 p2 = edge.p2;
 
             const double dx = p2.x - p1.x;
             const double dy = p2.y - p1.y;
@@ -744,7 +670,7 @@ bool Player::ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect
                 continue;
             }
 
-            if (!IsWalkableSlopeEdge(floor_poly, p1, p2))
+            if (!IsWalkableSlopeEdge(edge))
             {
                 continue;
             }
@@ -769,9 +695,7 @@ bool Player::ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect
             const double candidate_y = p1.y + dy * t;
             const double delta       = candidate_y - current_bottom;
 
-            const double edge_angle = GetEdgeAngleDegrees(p1, p2);
-
-            const double dynamic_step_up = edge_angle > 5.0 ? std::clamp(MAX_SURFACE_STEP_UP + std::abs(GetVelocity().x) * 0.03, MAX_SURFACE_STEP_UP, 24.0) : MAX_SURFACE_STEP_UP;
+            const double dynamic_step_up = edge.angle_degrees > 5.0 ? std::clamp(MAX_SURFACE_STEP_UP + std::abs(GetVelocity().x) * 0.03, MAX_SURFACE_STEP_UP, MAX_DYNAMIC_STEP_UP) : MAX_SURFACE_STEP_UP;
 
             const bool crossed_surface_candidate = prev_bottom >= candidate_y && current_bottom <= candidate_y + SURFACE_CONTACT_TOLERANCE;
 
@@ -832,9 +756,9 @@ bool Player::ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect
     return true;
 }
 
-bool Player::ResolveFloorCeilingCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_top)
+bool Player::ResolveFloorCeilingCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_top)
 {
-    if (floor_poly.vertexCount < 3 || velocityY <= 0.0)
+    if (floor_edges.Size() < 3 || velocityY <= 0.0)
     {
         return false;
     }
@@ -849,14 +773,17 @@ bool Player::ResolveFloorCeilingCollision(const Polygon& floor_poly, const Math:
     bool   found_ceiling = false;
     double ceiling_y     = 0.0;
 
+    // Only undersides between the previous and current head height can be crossed
+    floor_edges.Query(EdgeQueryBox(my_box.Left() - CEILING_X_MARGIN, prev_top, my_box.Right() + CEILING_X_MARGIN, current_top + CEILING_CONTACT_TOLERANCE), nearbyFloorEdges);
+
     auto try_head_probe_x = [&](double probe_x)
     {
-        const auto& verts = floor_poly.vertices;
-
-        for (size_t i = 0; i < verts.size(); ++i)
+        for (const uint32_t i : nearbyFloorEdges)
         {
-            Math::vec2 p1 = verts[i];
-            Math::vec2 p2 = verts[(i + 1) % verts.size()];
+            const CS230::PolygonEdges::Edge& edge = floor_edges[i];
+
+            const Math::vec2 p1 = edge.p1;
+            const Math::vec2 p2 = edge.p2;
 
             const double dx = p2.x - p1.x;
 
@@ -870,7 +797,7 @@ bool Player::ResolveFloorCeilingCollision(const Polygon& floor_poly, const Math:
                 continue;
             }
 
-            if (!IsBlockingBottomEdge(floor_poly, p1, p2))
+            if (!IsBlockingBottomEdge(edge))
             {
                 continue;
             }
@@ -917,9 +844,9 @@ bool Player::ResolveFloorCeilingCollision(const Polygon& floor_poly, const Math:
     return true;
 }
 
-bool Player::ResolveFloorVerticalWallCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right)
+bool Player::ResolveFloorVerticalWallCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right)
 {
-    if (floor_poly.vertexCount < 3)
+    if (floor_edges.Size() < 3)
     {
         return false;
     }
@@ -938,17 +865,19 @@ bool Player::ResolveFloorVerticalWallCollision(const Polygon& floor_poly, const
     const bool trying_right = moving_right || my_box.Right() > prev_right;
     const bool trying_left  = moving_left || my_box.Left() < prev_left;
 
-    const auto& verts = floor_poly.vertices;
-
-    auto is_walkable_nonflat_slope = [&](Math::vec2 a, Math::vec2 b)
+    auto is_walkable_nonflat_slope = [](const CS230::PolygonEdges::Edge& edge)
     {
-        return IsWalkableSlopeEdge(floor_poly, a, b) && GetEdgeAngleDegrees(a, b) > SLOPE_SEAM_MIN_ANGLE_DEG;
+        return IsWalkableSlopeEdge(edge) && edge.angle_degrees > SLOPE_SEAM_MIN_ANGLE_DEG;
     };
 
-    for (size_t i = 0; i < verts.size(); ++i)
+    // A wall can only be hit if it lies within the horizontal sweep and overlaps the body vertically
+    floor_edges.Query(
+        EdgeQueryBox(std::min(prev_left, my_box.Left()) - WALL_CROSS_TOLERANCE, my_box.Bottom(), std::max(prev_right, my_box.Right()) + WALL_CROSS_TOLERANCE, my_box.Top()), nearbyFloorEdges);
+
+    for (const uint32_t i : nearbyFloorEdges)
     {
-        Math::vec2 p1 = verts[i];
-        Math::vec2 p2 = verts[(i + 1) % verts.size()];
+        const Math::vec2 p1 = floor_edges[i].p1;
+        const Math::vec2 p2 = floor_edges[i].p2;
 
         const double dx = p2.x - p1.x;
         const double dy = p2.y - p1.y;
@@ -964,12 +893,9 @@ bool Player::ResolveFloorVerticalWallCollision(const Polygon& floor_poly, const
             continue;
         }
 
-        const Math::vec2 prev = verts[(i + verts.size() - 1) % verts.size()];
-        const Math::vec2 next = verts[(i + 2) % verts.size()];
-
-        const bool p1_connected_to_sloped_surface = is_walkable_nonflat_slope(prev, p1);
+        const bool p1_connected_to_sloped_surface = is_walkable_nonflat_slope(floor_edges[floor_edges.Previous(i)]);
 
-        const bool p2_connected_to_sloped_surface = is_walkable_nonflat_slope(p2, next);
+        const bool p2_connected_to_sloped_surface = is_walkable_nonflat_slope(floor_edges[floor_edges.Next(i)]);
 
         const bool foot_near_p1 = std::abs(my_box.Bottom() - p1.y) <= SLOPE_SEAM_FOOT_MARGIN;
 
@@ -1029,9 +955,9 @@ bool Player::ResolveFloorVerticalWallCollision(const Polygon& floor_poly, const
     return false;
 }
 
-bool Player::ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top)
+bool Player::ResolveFloorDiagonalWallCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top)
 {
-    if (floor_poly.vertexCount < 3)
+    if (floor_edges.Size() < 3)
     {
         return false;
     }
@@ -1070,14 +996,17 @@ bool Player::ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const
     Math::vec2 left_block_normal  = { 0.0, 0.0 };
     Math::vec2 right_block_normal = { 0.0, 0.0 };
 
+    // Probes span the vertical sweep; a blocking edge point has to be within the cross tolerance of the body
+    floor_edges.Query(EdgeQueryBox(current_left - CROSS_TOLERANCE, swept_bottom - Y_MARGIN, current_right + CROSS_TOLERANCE, swept_top + Y_MARGIN), nearbyFloorEdges);
+
     auto test_probe_y = [&](double probe_y)
     {
-        const auto& verts = floor_poly.vertices;
-
-        for (size_t i = 0; i < verts.size(); ++i)
+        for (const uint32_t i : nearbyFloorEdges)
         {
-            Math::vec2 p1 = verts[i];
-            Math::vec2 p2 = verts[(i + 1) % verts.size()];
+            const CS230::PolygonEdges::Edge& edge = floor_edges[i];
+
+            const Math::vec2 p1 = edge.p1;
+            const Math::vec2 p2 = edge.p2;
 
             const double dx = p2.x - p1.x;
             const double dy = p2.y - p1.y;
@@ -1097,17 +1026,14 @@ bool Player::ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const
                 continue;
             }
 
-            if (IsWalkableSlopeEdge(floor_poly, p1, p2))
+            if (IsWalkableSlopeEdge(edge))
             {
                 continue;
             }
 
-            const Math::vec2 prev = verts[(i + verts.size() - 1) % verts.size()];
-            const Math::vec2 next = verts[(i + 2) % verts.size()];
-
-            const bool connected_to_walkable_slope = IsWalkableSlopeEdge(floor_poly, prev, p1) || IsWalkableSlopeEdge(floor_poly, p2, next);
+            const bool connected_to_walkable_slope = IsWalkableSlopeEdge(floor_edges[floor_edges.Previous(i)]) || IsWalkableSlopeEdge(floor_edges[floor_edges.Next(i)]);
 
-            const double edge_angle = GetEdgeAngleDegrees(p1, p2);
+            const double edge_angle = edge.angle_degrees;
 
             constexpr double DIAGONAL_SEAM_MAX_EDGE_HEIGHT = 128.0;
             constexpr double DIAGONAL_SEAM_MAX_EDGE_ANGLE  = 80.0;
@@ -1140,7 +1066,7 @@ bool Player::ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const
                 continue;
             }
 
-            const Math::vec2 outward = GetEdgeOutwardNormal(floor_poly, p1, p2);
+            const Math::vec2 outward = edge.outward;
 
             // Strong downward-facing edges are underside/ceiling-like.
             // Do not resolve them as side walls, because that can push the player
@@ -1299,9 +1225,9 @@ bool Player::ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const
     return true;
 }
 
-bool Player::ResolveFloorVertexSideCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top)
+bool Player::ResolveFloorVertexSideCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top)
 {
-    if (floor_poly.vertexCount < 3)
+    if (floor_edges.Size() < 3)
     {
         return false;
     }
@@ -1334,21 +1260,25 @@ bool Player::ResolveFloorVertexSideCollision(const Polygon& floor_poly, const Ma
     double left_block_x           = 999999.0;
     double right_block_x          = -999999.0;
 
-    const auto& verts = floor_poly.vertices;
+    // Vertex i starts edge i, so any vertex inside the box brings its edge back from the query
+    floor_edges.Query(EdgeQueryBox(current_left - CROSS_TOLERANCE, swept_bottom, current_right + CROSS_TOLERANCE, swept_top), nearbyFloorEdges);
 
-    for (size_t i = 0; i < verts.size(); ++i)
+    for (const uint32_t i : nearbyFloorEdges)
     {
-        const Math::vec2 vertex = verts[i];
+        const CS230::PolygonEdges::Edge& edge          = floor_edges[i];
+        const CS230::PolygonEdges::Edge& previous_edge = floor_edges[floor_edges.Previous(i)];
+
+        const Math::vec2 vertex = edge.p1;
 
         if (vertex.y < swept_bottom || vertex.y > swept_top)
         {
             continue;
         }
 
-        const Math::vec2 prev_vertex = verts[(i + verts.size() - 1) % verts.size()];
-        const Math::vec2 next_vertex = verts[(i + 1) % verts.size()];
+        const Math::vec2 prev_vertex = previous_edge.p1;
+        const Math::vec2 next_vertex = edge.p2;
 
-        const bool connected_to_walkable_surface = IsWalkableSlopeEdge(floor_poly, prev_vertex, vertex) || IsWalkableSlopeEdge(floor_poly, vertex, next_vertex);
+        const bool connected_to_walkable_surface = IsWalkableSlopeEdge(previous_edge) || IsWalkableSlopeEdge(edge);
 
         // A path-to-path seam often appears as a local top vertex.
         // A real wall base is usually a local bottom vertex, so do not skip that.
@@ -1610,9 +1540,9 @@ void Player::ResolveCollision(GameObject* other_object)
         if (!my_collider)
             return;
 
-        Math::rect other_box;
-        Polygon    floor_poly;
-        bool       has_floor_poly = false;
+        Math::rect     other_box;
+        const Polygon*             floor_poly  = nullptr;
+        const CS230::PolygonEdges* floor_edges = nullptr;
 
         if (other_object->Type() == GameObjectTypes::Floor)
         {
@@ -1620,9 +1550,9 @@ void Player::ResolveCollision(GameObject* other_object)
             if (!floor_collider)
                 return;
 
-            floor_poly     = floor_collider->WorldBoundary();
-            has_floor_poly = true;
-            other_box      = floor_poly.FindBoundary();
+            floor_poly  = &floor_collider->WorldBoundary();
+            floor_edges = &floor_collider->WorldEdges();
+            other_box   = floor_collider->WorldBoundingBox();
         }
         else if (other_object->Type() == GameObjectTypes::Gate)
         {
@@ -1669,12 +1599,12 @@ void Player::ResolveCollision(GameObject* other_object)
 
         auto is_axis_aligned_rect_floor = [&]()
         {
-            if (other_object->Type() != GameObjectTypes::Floor || !has_floor_poly)
+            if (other_object->Type() != GameObjectTypes::Floor || floor_poly == nullptr)
                 return false;
 
             std::vector<Math::vec2> unique_vertices;
 
-            for (const Math::vec2& v : floor_poly.vertices)
+            for (const Math::vec2& v : floor_poly->vertices)
             {
                 bool already_exists = false;
 
@@ -1717,29 +1647,29 @@ void Player::ResolveCollision(GameObject* other_object)
         if (!horizontal_overlap || !vertical_overlap)
             return;
 
-        if (other_object->Type() == GameObjectTypes::Floor && has_floor_poly && !can_use_aabb_fallback)
+        if (other_object->Type() == GameObjectTypes::Floor && floor_edges != nullptr && !can_use_aabb_fallback)
         {
-            if (ResolveFloorVerticalWallCollision(floor_poly, my_box, prev_left, prev_right))
+            if (ResolveFloorVerticalWallCollision(*floor_edges, my_box, prev_left, prev_right))
             {
                 return;
             }
 
-            if (ResolveFloorDiagonalWallCollision(floor_poly, my_box, prev_left, prev_right, prev_bottom, prev_top))
+            if (ResolveFloorDiagonalWallCollision(*floor_edges, my_box, prev_left, prev_right, prev_bottom, prev_top))
             {
                 return;
             }
 
-            if (ResolveFloorVertexSideCollision(floor_poly, my_box, prev_left, prev_right, prev_bottom, prev_top))
+            if (ResolveFloorVertexSideCollision(*floor_edges, my_box, prev_left, prev_right, prev_bottom, prev_top))
             {
                 return;
             }
 
-            if (ResolveFloorSurfaceSnap(floor_poly, my_box, prev_bottom))
+            if (ResolveFloorSurfaceSnap(*floor_edges, my_box, prev_bottom))
             {
                 return;
             }
 
-            if (ResolveFloorCeilingCollision(floor_poly, my_box, prev_top))
+            if (ResolveFloorCeilingCollision(*floor_edges, my_box, prev_top))
             {
                 return;
             }
@@ -1846,7 +1776,8 @@ void Player::Draw(const Math::TransformationMatrix& camera_matrix)
             return;
     }
 
-    Math::vec2 feet = { GetPosition().x, GetPosition().y - collisionHalfHeight };
+    const Math::vec2 renderPos = GetRenderPosition();
+    Math::vec2       feet      = { renderPos.x, renderPos.y - collisionHalfHeight };
     oriAnim.Draw(feet, faceRight);
 
     // Water rush visual: blue spray from wall + trailing droplets
@@ -2036,7 +1967,7 @@ void Player::DrawImGui()
         float      p[2] = { static_cast<float>(pos.x), static_cast<float>(pos.y) };
         if (ImGui::DragFloat2("Position", p))
         {
-            SetPosition({ static_cast<double>(p[0]), static_cast<double>(p[1]) });
+            Teleport({ static_cast<double>(p[0]), static_cast<double>(p[1]) });
         }
 
         Math::vec2 vel  = GetVelocity();
@@ -21,6 +21,11 @@ namespace CS200
     class IRenderer2D;
 }
 
+namespace CS230
+{
+    class PolygonEdges;
+}
+
 class Player : public CS230::GameObject
 {
 public:
@@ -105,11 +110,11 @@ private:
     void HitCeiling(double ceiling_y);
     void HitWall(double wall_x, int direction);
 
-    bool ResolveFloorSurfaceSnap(const Polygon& floor_poly, const Math::rect& my_box, double prev_bottom);
-    bool ResolveFloorCeilingCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_top);
-    bool ResolveFloorVerticalWallCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right);
-    bool ResolveFloorDiagonalWallCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top);
-    bool ResolveFloorVertexSideCollision(const Polygon& floor_poly, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top);
+    bool ResolveFloorSurfaceSnap(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_bottom);
+    bool ResolveFloorCeilingCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_top);
+    bool ResolveFloorVerticalWallCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right);
+    bool ResolveFloorDiagonalWallCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top);
+    bool ResolveFloorVertexSideCollision(const CS230::PolygonEdges& floor_edges, const Math::rect& my_box, double prev_left, double prev_right, double prev_bottom, double prev_top);
     bool ResolveAABBFallback(const Math::rect& my_box, const Math::rect& other_box, double prev_bottom, double prev_top, double prev_left, double prev_right);
 
     const double collisionHalfHeight = 40.0;
@@ -204,4 +209,10 @@ private:
     double     waterRushTimer  = 0.0;
     Math::vec2 waterRushDir    = { 0.0, 0.0 };
     Math::vec2 waterRushOrigin = { 0.0, 0.0 };
+
+    // Scratch list of floor edge indices near the player, reused by the ResolveFloor* passes
+    std::vector<uint32_t> nearbyFloorEdges;
+
+    // Scratch list for trigger volume queries (water zones)
+    std::vector<CS230::GameObject*> nearbyVolumes;
 };
@@ -13,6 +13,8 @@ void PostProcessor::Initialize(Math::ivec2 windowSize)
         std::filesystem::path("Assets/shaders/PostProcess.vert"),
         std::filesystem::path("Assets/shaders/Bloom.frag")
     );
+    sceneTextureUniform     = OpenGL::GetUniform(shader, "u_SceneTexture");
+    bloomMaskTextureUniform = OpenGL::GetUniform(shader, "u_BloomMaskTexture");
 
     std::vector<float> quadVertices = {
         -1.0f, -1.0f, 0.0f, 0.0f,
@@ -50,13 +52,11 @@ void PostProcessor::EndRenderAndDraw()
 
     GL::ActiveTexture(GL_TEXTURE0);
     GL::BindTexture(GL_TEXTURE_2D, sceneFBO.ColorAttachment);
-    GLint loc0 = GL::GetUniformLocation(shader.Shader, "u_SceneTexture");
-    if (loc0 != -1) GL::Uniform1i(loc0, 0);
+    if (sceneTextureUniform.IsValid()) GL::Uniform1i(sceneTextureUniform.Location, 0);
 
     GL::ActiveTexture(GL_TEXTURE1);
     GL::BindTexture(GL_TEXTURE_2D, bloomMaskFBO.ColorAttachment);
-    GLint loc1 = GL::GetUniformLocation(shader.Shader, "u_BloomMaskTexture");
-    if (loc1 != -1) GL::Uniform1i(loc1, 1);
+    if (bloomMaskTextureUniform.IsValid()) GL::Uniform1i(bloomMaskTextureUniform.Location, 1);
 
     GL::BindVertexArray(quadVAO);
     GL::DrawArrays(GL_TRIANGLE_FAN, 0, 4);
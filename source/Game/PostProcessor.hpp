@@ -19,6 +19,8 @@ private:
     OpenGL::FramebufferWithColor sceneFBO;
     OpenGL::FramebufferWithColor bloomMaskFBO; 
     OpenGL::CompiledShader       shader;
+    OpenGL::UniformHandle        sceneTextureUniform;
+    OpenGL::UniformHandle        bloomMaskTextureUniform;
     OpenGL::VertexArrayHandle    quadVAO;
     OpenGL::BufferHandle         quadVBO;
 };
\ No newline at end of file
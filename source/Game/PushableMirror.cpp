@@ -39,7 +39,7 @@ void PushableMirror::Update(double dt)
 void PushableMirror::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     auto&                      renderer  = Engine::GetRenderer2D();
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(size);
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(size);
 
     // Draw the main body of the pushable block
     renderer.DrawRectangle(transform, 0x00FFFF80, CS200::WHITE, 2.0);
@@ -49,7 +49,7 @@ void PushableMirror::Draw(const Math::TransformationMatrix& camera_matrix)
     Math::vec2 p1   = { -half.x, half.y };
     Math::vec2 p2   = { half.x, -half.y };
 
-    renderer.DrawLine(GetMatrix(), p1, p2, 0xDDDDDDFF, 5.0);
+    renderer.DrawLine(GetRenderMatrix(), p1, p2, 0xDDDDDDFF, 5.0);
 
     CS230::GameObject::Draw(camera_matrix);
 }
@@ -70,7 +70,7 @@ void PushableMirror::ResolveCollision(CS230::GameObject* other_object)
             return;
 
         Math::rect my_box    = my_collider->WorldBoundary();
-        Math::rect other_box = other_collider->WorldBoundary().FindBoundary();
+        Math::rect other_box = other_collider->WorldBoundingBox();
 
         if (my_box.Right() > other_box.Left() && my_box.Left() < other_box.Right() && my_box.Top() > other_box.Bottom() && my_box.Bottom() < other_box.Top())
         {
@@ -102,4 +102,10 @@ std::vector<std::pair<Math::vec2, Math::vec2>> PushableMirror::GetSegments() con
     return {
         { p1, p2 }
     };
+}
+
+void PushableMirror::AppendLaserSegments(std::vector<Physics::LineSegment>& out)
+{
+    for (const auto& s : GetSegments())
+        out.push_back({ s.first, s.second, true });
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/GameObject.hpp"
 #include "Engine/GameObjectTypes.hpp"
+#include "Engine/Physics/Reflection.hpp"
 #include "Engine/Vec2.hpp"
 #include <vector>
 #include <utility>
@@ -21,6 +22,7 @@ public:
 
     // Returns the diagonal reflective surface for laser bounce calculations
     std::vector<std::pair<Math::vec2, Math::vec2>> GetSegments() const;
+    void                                           AppendLaserSegments(std::vector<Physics::LineSegment>& out) override;
 
     // Applies horizontal velocity when pushed by the player
     void Push(Math::vec2 pushVelocity);
@@ -29,12 +29,16 @@ void RedLaser::Update([[maybe_unused]] double dt)
     }
 
     int bounces = 0;
-    CalculatePath(bounces, laserLength);
+    RequestPath(bounces, laserLength, dt);
+}
+
+void RedLaser::OnPathReady(double dt)
+{
     CheckTargetIntersections(15.0);
 
     if (isParried && !hasEmittedParryParticle && pathPoints.size() >= 2)
     {
-        Math::vec2 hitPos = startPos + (direction * laserLength);
+        Math::vec2 hitPos = startPos + (direction * traceLength);
 
         for (int i = 0; i < 6; ++i)
         {
@@ -16,6 +16,7 @@ class RedLaser : public Laser
 public:
     RedLaser(Math::vec2 in_startPos, Math::vec2 dir, Player* in_player);
     void Update([[maybe_unused]] double dt) override;
+    void OnPathReady(double dt) override;
     void Draw(const Math::TransformationMatrix& camera_matrix) override;
 
     GameObjectTypes Type() override
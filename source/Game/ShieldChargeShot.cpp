@@ -28,7 +28,15 @@ namespace Boss
 
     void ShieldChargeShot::SetTargetStars(const std::vector<TargetStar*>& in_targetStars)
     {
-        targetStars = in_targetStars;
+        targetStars.clear();
+
+        for (TargetStar* target : in_targetStars)
+        {
+            if (target != nullptr)
+            {
+                targetStars.push_back(target->GetHandle());
+            }
+        }
     }
 
     void ShieldChargeShot::Update(double dt)
@@ -276,42 +284,42 @@ namespace Boss
             return end;
         }
 
+        constexpr GameObjectTypes blockerTypes[] = { GameObjectTypes::Floor, GameObjectTypes::Gate, GameObjectTypes::Door, GameObjectTypes::Pillar };
+
         double bestT = 1.0;
 
-        for (auto obj : gom->GetObjects())
+        for (GameObjectTypes type : blockerTypes)
         {
-            if (obj == nullptr || !obj->IsActive())
+            for (auto obj : gom->GetObjectsOfType(type))
             {
-                continue;
-            }
-
-            if (!IsChargeShotBlocker(obj->Type()))
-            {
-                continue;
-            }
+                if (!obj->IsActive())
+                {
+                    continue;
+                }
 
-            auto collider = obj->GetGOComponent<CS230::Collision>();
+                auto collider = obj->GetGOComponent<CS230::Collision>();
 
-            if (collider == nullptr)
-            {
-                continue;
-            }
+                if (collider == nullptr)
+                {
+                    continue;
+                }
 
-            if (collider->Shape() != CS230::Collision::CollisionShape::Rect)
-            {
-                continue;
-            }
+                if (collider->Shape() != CS230::Collision::CollisionShape::Rect)
+                {
+                    continue;
+                }
 
-            auto             rectCollider = static_cast<CS230::RectCollision*>(collider);
-            const Math::rect rect         = rectCollider->WorldBoundary();
+                auto             rectCollider = static_cast<CS230::RectCollision*>(collider);
+                const Math::rect rect         = rectCollider->WorldBoundary();
 
-            double t = 1.0;
+                double t = 1.0;
 
-            if (SegmentIntersectsRect(start, end, rect, t))
-            {
-                if (t < bestT)
+                if (SegmentIntersectsRect(start, end, rect, t))
                 {
-                    bestT = t;
+                    if (t < bestT)
+                    {
+                        bestT = t;
+                    }
                 }
             }
         }
@@ -321,12 +329,25 @@ namespace Boss
 
     TargetStar* ShieldChargeShot::FindFirstHitTarget(Math::vec2 start, Math::vec2 end) const
     {
+        auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
+
+        if (gom == nullptr)
+        {
+            return nullptr;
+        }
+
         TargetStar* bestTarget            = nullptr;
         double      bestDistanceFromStart = std::numeric_limits<double>::max();
 
-        for (TargetStar* target : targetStars)
+        // Targets near the beam first, then only the ones this shot is aimed at (the constellation's)
+        queryCandidates.clear();
+        gom->QueryCapsule(start, end, Config::ChargeShotHitRadius, GameObjectTypes::Target, queryCandidates);
+
+        for (CS230::GameObject* candidate : queryCandidates)
         {
-            if (target == nullptr || target->IsHit())
+            TargetStar* target = static_cast<TargetStar*>(candidate);
+
+            if (target->IsHit() || std::find(targetStars.begin(), targetStars.end(), target->GetHandle()) == targetStars.end())
             {
                 continue;
             }
@@ -363,14 +384,12 @@ namespace Boss
         LaserCutRope* bestRope              = nullptr;
         double        bestDistanceFromStart = std::numeric_limits<double>::max();
 
-        for (auto obj : gom->GetObjects())
-        {
-            if (obj == nullptr || !obj->IsActive())
-            {
-                continue;
-            }
+        queryCandidates.clear();
+        gom->QueryCapsule(start, end, 0.0, GameObjectTypes::LaserCutRope, queryCandidates);
 
-            if (obj->Type() != GameObjectTypes::LaserCutRope)
+        for (auto obj : queryCandidates)
+        {
+            if (!obj->IsActive())
             {
                 continue;
             }
@@ -411,19 +430,6 @@ namespace Boss
         return bestRope;
     }
 
-    bool ShieldChargeShot::IsChargeShotBlocker(GameObjectTypes type)
-    {
-        switch (type)
-        {
-            case GameObjectTypes::Floor:
-            case GameObjectTypes::Gate:
-            case GameObjectTypes::Door:
-            case GameObjectTypes::Pillar: return true;
-
-            default: return false;
-        }
-    }
-
     bool ShieldChargeShot::SegmentIntersectsRect(Math::vec2 start, Math::vec2 end, const Math::rect& rect, double& out_t)
     {
         const Math::vec2 direction = end - start;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Engine/GameObjectHandle.hpp"
 #include "Engine/GameObjectTypes.hpp"
 #include "Engine/Matrix.hpp"
 #include "Engine/Vec2.hpp"
@@ -10,6 +11,11 @@ class Player;
 class TargetStar;
 class LaserCutRope;
 
+namespace CS230
+{
+    class GameObject;
+}
+
 namespace Boss
 {
     class ShieldEnergy;
@@ -39,7 +45,6 @@ namespace Boss
         TargetStar*   FindFirstHitTarget(Math::vec2 start, Math::vec2 end) const;
         LaserCutRope* FindFirstHitRope(Math::vec2 start, Math::vec2 end) const;
 
-        static bool IsChargeShotBlocker(GameObjectTypes type);
         static bool SegmentIntersectsRect(Math::vec2 start, Math::vec2 end, const Math::rect& rect, double& out_t);
 
         static double DistanceToSegmentSquared(Math::vec2 point, Math::vec2 a, Math::vec2 b);
@@ -47,7 +52,11 @@ namespace Boss
         Player*       player       = nullptr;
         ShieldEnergy* shieldEnergy = nullptr;
 
-        std::vector<TargetStar*> targetStars;
+        // Handles rather than pointers so a destroyed target is skipped instead of dereferenced
+        std::vector<CS230::GameObjectHandle> targetStars;
+
+        // Scratch for GameObjectManager::QueryCapsule so the per-frame preview does not allocate
+        mutable std::vector<CS230::GameObject*> queryCandidates;
 
         bool isCharging  = false;
         bool readyToFire = false;
@@ -20,7 +20,7 @@ Sign::Sign(Math::vec2 start_pos, Math::vec2 size, std::string msg) : CS230::Game
 void Sign::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     CS200::IRenderer2D&        renderer  = Engine::GetRenderer2D();
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix(signSize);
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix(signSize);
 
     // Draw the sign's physical body as a yellow rectangle
     renderer.DrawRectangle(transform, 0xFFFF00FF, CS200::CLEAR, 0.0);
@@ -4,10 +4,7 @@
 #include "Engine/GameObjectManager.hpp"
 #include "Engine/GameStateManager.hpp"
 #include "Engine/MapElement.h"
-#include "Gate.hpp"
-#include "Mirror.hpp"
 #include "Player.hpp"
-#include "PushableMirror.hpp"
 #include "Shield.hpp"
 #include "TargetStar.hpp"
 
@@ -70,7 +67,7 @@ void Star::Draw(const Math::TransformationMatrix& camera_matrix)
 {
     auto& renderer = Engine::GetRenderer2D();
 
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix({ 40.0, 40.0 });
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix({ 40.0, 40.0 });
     renderer.DrawCircle(transform, GetBodyColor());
 
     if (currentState == State::Warning)
@@ -86,7 +83,9 @@ void Star::DrawTrajectory()
     if (player == nullptr)
         return;
 
-    std::vector<Physics::LineSegment> allSegments;
+    // Reused between traces so a steady-state trace does not allocate
+    std::vector<Physics::LineSegment>& allSegments = traceSegments;
+    allSegments.clear();
 
     Shield* shield = player->GetShield();
     if (shield && shield->IsGuardUp())
@@ -99,46 +98,16 @@ void Star::DrawTrajectory()
     auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
     if (gom != nullptr)
     {
-        for (auto obj : gom->GetObjects())
-        {
-            if (obj->Type() == GameObjectTypes::Mirror)
-            {
-                allSegments.push_back(static_cast<Mirror*>(obj)->GetReflectiveSegment());
-            }
-            else if (obj->Type() == GameObjectTypes::PushableMirror)
-            {
-                auto mirror = static_cast<PushableMirror*>(obj);
-                auto segs   = mirror->GetSegments();
-                for (const auto& s : segs)
-                    allSegments.push_back({ s.first, s.second, true });
-            }
-            else if (obj->Type() == GameObjectTypes::Floor)
-            {
-                auto wall = static_cast<CS230::MapElement*>(obj);
-                auto segs = wall->GetWallSegments();
-                allSegments.insert(allSegments.end(), segs.begin(), segs.end());
-            }
-            else if (obj->Type() == GameObjectTypes::Gate)
-            {
-                auto gate = static_cast<Gate*>(obj);
-                if (!gate->IsOpen())
-                {
-                    Math::vec2 p = gate->GetPosition();
-                    allSegments.push_back(
-                        {
-                            { p.x - 50, p.y },
-                            { p.x + 50, p.y },
-                            false
-                    });
-                }
-            }
-        }
+        // Mirrors and closed gates are cached by the manager until one of them changes
+        const auto& occluders = gom->GetDynamicLaserSegments();
+        allSegments.insert(allSegments.end(), occluders.begin(), occluders.end());
     }
 
     Math::vec2 dir = (player->GetPosition() - GetPosition()).Normalize();
 
     int  bounces = GetMaxBounces();
-    auto path    = Physics::CalculateLaserPath(GetPosition(), dir, allSegments, bounces, 15000.0);
+    auto path    = gom != nullptr ? Physics::CalculateLaserPath(GetPosition(), dir, gom->GetTerrainSegments(), allSegments, bounces, 15000.0)
+                                  : Physics::CalculateLaserPath(GetPosition(), dir, allSegments, bounces, 15000.0);
 
     auto&       renderer  = Engine::GetRenderer2D();
     CS200::RGBA lineColor = GetTelegraphColor();
@@ -1,6 +1,7 @@
 #pragma once
 #include "CS200/RGBA.hpp"
 #include "Engine/GameObject.hpp"
+#include "Engine/Physics/Reflection.hpp"
 #include <vector>
 
 class Player;
@@ -38,6 +39,8 @@ protected:
     double warningDuration  = 2.0;
     double cooldownDuration = 3.0;
 
+    std::vector<Physics::LineSegment> traceSegments;
+
     void HandleBasicAI(double dt);
     void DrawTrajectory();
 };
\ No newline at end of file
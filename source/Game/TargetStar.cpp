@@ -43,7 +43,7 @@ void TargetStar::Update(double dt)
 void TargetStar::Draw([[maybe_unused]] const Math::TransformationMatrix& camera_matrix)
 {
     auto&                      renderer  = Engine::GetRenderer2D();
-    Math::TransformationMatrix transform = GetMatrix() * Math::ScaleMatrix({ radius, radius });
+    Math::TransformationMatrix transform = GetRenderMatrix() * Math::ScaleMatrix({ radius, radius });
 
     // Draw the target visually as a circle (Color changes based on hit progress/activation)
     renderer.DrawCircle(transform, color);
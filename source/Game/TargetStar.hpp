@@ -16,6 +16,7 @@ public:
 
     bool IsHit() const;
     double GetRadius() const;
+    double GetQueryRadius() const override { return radius; }
 
     GameObjectTypes Type() override { return GameObjectTypes::Target; }
     std::string TypeName() override { return "TargetStar"; }
@@ -1,4 +1,5 @@
 #include "WaterZone.hpp"
+#include "CS200/IRenderer2D.hpp"
 #include "Engine/Engine.hpp"
 #include "OpenGL/Shader.hpp"
 
@@ -21,6 +22,9 @@ WaterZone::WaterZone(Math::vec2 pos, Math::vec2 size)
 
 WaterZone::~WaterZone()
 {
+    if (Engine::IsHeadless())
+        return;
+
     if (_vao) { GL::DeleteVertexArrays(1, &_vao); _vao = 0; }
     if (_vbo) { GL::DeleteBuffers(1, &_vbo);      _vbo = 0; }
 
@@ -30,6 +34,9 @@ WaterZone::~WaterZone()
 
 void WaterZone::EnsureGL()
 {
+    if (Engine::IsHeadless())
+        return;
+
     if (s_refCount == 0)
     {
         namespace fs = std::filesystem;
@@ -78,6 +85,13 @@ double WaterZone::GetSubmergedDepth(double worldX, double worldBottomY) const
     return std::max(0.0, std::min(surfaceY - worldBottomY, size.y));
 }
 
+bool WaterZone::GetTriggerBounds(Math::rect& bounds) const
+{
+    const Math::vec2 half = size * 0.5;
+    bounds                = { GetPosition() - half, GetPosition() + half };
+    return true;
+}
+
 void WaterZone::Update(double dt)
 {
     waveTime += dt;
@@ -110,7 +124,8 @@ void WaterZone::Draw(const Math::TransformationMatrix& camera_matrix)
     GL::BufferSubData(GL_ARRAY_BUFFER, 0, sizeof(verts), verts);
     GL::BindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Draw
+    // Draw (after whatever a batching renderer still holds, so the water stays in front of it)
+    Engine::GetRenderer2D().Flush();
     GL::UseProgram(s_shader.Shader);
 
     if (s_timeLoc >= 0)
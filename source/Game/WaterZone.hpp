@@ -27,6 +27,9 @@ public:
 
     double GetSurfaceY() const { return GetPosition().y + size.y * 0.5; }
 
+    // Registers the water body as a trigger volume so the player only tests nearby zones
+    bool GetTriggerBounds(Math::rect& bounds) const override;
+
 private:
     Math::vec2 size;
     double     waveTime = 0.0;
@@ -9,12 +9,16 @@ WhiteLaser::WhiteLaser(Math::vec2 in_startPos, Math::vec2 in_dir, Player* in_pla
     color = 0xFFFFFFFF;
 }
 
-void WhiteLaser::Update([[maybe_unused]] double dt)
+void WhiteLaser::Update(double dt)
 {
     if (!isActive)
         return;
 
-    CalculatePath(maxBounces, maxLength);
+    RequestPath(maxBounces, maxLength, dt);
+}
+
+void WhiteLaser::OnPathReady([[maybe_unused]] double dt)
+{
     CheckTargetIntersections(hitRadius);
 
     auto gom = Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>();
@@ -22,21 +26,20 @@ void WhiteLaser::Update([[maybe_unused]] double dt)
     if (gom == nullptr)
         return;
 
-    for (auto obj : gom->GetObjects())
+    for (size_t i = 0; i < pathPoints.size() - 1; ++i)
     {
-        if (obj->Type() == GameObjectTypes::Target)
+        hitCandidates.clear();
+        gom->QueryCapsule(pathPoints[i], pathPoints[i + 1], 0.0, GameObjectTypes::Target, hitCandidates);
+
+        for (auto obj : hitCandidates)
         {
             TargetStar* target    = static_cast<TargetStar*>(obj);
             Math::vec2  targetPos = target->GetPosition();
             double      hitRad    = target->GetRadius();
 
-            for (size_t i = 0; i < pathPoints.size() - 1; ++i)
+            if (DistToSegmentSquared(targetPos, pathPoints[i], pathPoints[i + 1]) < hitRad * hitRad)
             {
-                if (DistToSegmentSquared(targetPos, pathPoints[i], pathPoints[i + 1]) < hitRad * hitRad)
-                {
-                    target->OnHit();
-                    break;
-                }
+                target->OnHit();
             }
         }
     }
@@ -8,6 +8,7 @@ public:
     WhiteLaser(Math::vec2 in_startPos, Math::vec2 in_dir, Player* in_player);
 
     void Update(double dt) override;
+    void OnPathReady(double dt) override;
 
     GameObjectTypes Type() override
     {
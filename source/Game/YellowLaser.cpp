@@ -23,7 +23,11 @@ void YellowLaser::Update([[maybe_unused]] double dt)
             currentLength = maxLaserLength;
         }
     }
-    CalculatePath(5, currentLength);
+    RequestPath(5, currentLength, dt);
+}
+
+void YellowLaser::OnPathReady([[maybe_unused]] double dt)
+{
     CheckTargetIntersections(15.0);
 
     if (player == nullptr)
@@ -8,6 +8,7 @@ class YellowLaser : public Laser
 public:
     YellowLaser(Math::vec2 in_startPos, Math::vec2 dir, Player* in_player);
     void Update([[maybe_unused]] double dt) override;
+    void OnPathReady(double dt) override;
 
     GameObjectTypes Type() override
     {
@@ -12,6 +12,7 @@
 #include "Engine/Logger.hpp"
 #include "GL.hpp"
 
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -110,6 +111,52 @@ namespace
 #    define glCheck(expression)  expression
 #endif
 
+namespace
+{
+    // Last value handed to the driver for each piece of state the wrapper filters, so binds and
+    // toggles that would not change anything never reach it. UNKNOWN means the value is not known
+    // (startup, or after InvalidateStateCache()) and the next call always goes through.
+    // Only calls made through GL:: are seen; code that touches state directly must invalidate.
+    constexpr GLuint UNKNOWN          = ~GLuint{ 0 };
+    constexpr GLuint MAX_CACHED_UNITS = 32;
+
+    struct StateCache
+    {
+        StateCache() noexcept
+        {
+            Texture2D.fill(UNKNOWN);
+        }
+
+        GLuint                               Program         = UNKNOWN;
+        GLuint                               VertexArray     = UNKNOWN;
+        GLuint                               DrawFramebuffer = UNKNOWN;
+        GLuint                               ReadFramebuffer = UNKNOWN;
+        GLenum                               ActiveTexture   = UNKNOWN;
+        std::array<GLuint, MAX_CACHED_UNITS> Texture2D{};
+        GLuint                               Blend          = UNKNOWN;
+        GLenum                               BlendSrcFactor = UNKNOWN;
+        GLenum                               BlendDstFactor = UNKNOWN;
+        std::array<GLint, 4>                 Viewport{};
+        bool                                 ViewportKnown = false;
+        GL::StateCacheStats                  Stats{};
+    };
+
+    StateCache gStateCache;
+
+    // Records value and returns true when the call has to reach the driver
+    bool state_changes(GLuint& cached, GLuint value) noexcept
+    {
+        if (cached == value)
+        {
+            ++gStateCache.Stats.Elided;
+            return false;
+        }
+        cached = value;
+        ++gStateCache.Stats.Issued;
+        return true;
+    }
+}
+
 
 namespace GL
 {
@@ -181,7 +228,10 @@ namespace GL
 
     void ActiveTexture(GLenum texture SOURCE_LOCATION)
     {
-        glCheck(glActiveTexture(texture));
+        if (state_changes(gStateCache.ActiveTexture, texture))
+        {
+            glCheck(glActiveTexture(texture));
+        }
     }
 
     void AttachShader(GLuint program, GLuint shader SOURCE_LOCATION)
@@ -201,7 +251,18 @@ namespace GL
 
     void BindTexture(GLenum target, GLuint texture SOURCE_LOCATION)
     {
-        glCheck(glBindTexture(target, texture));
+        // Only GL_TEXTURE_2D on a known unit is tracked; an unknown unit wraps past MAX_CACHED_UNITS
+        const GLuint unit = gStateCache.ActiveTexture - GL_TEXTURE0;
+        if (target != GL_TEXTURE_2D || unit >= MAX_CACHED_UNITS)
+        {
+            ++gStateCache.Stats.Issued;
+            glCheck(glBindTexture(target, texture));
+            return;
+        }
+        if (state_changes(gStateCache.Texture2D[unit], texture))
+        {
+            glCheck(glBindTexture(target, texture));
+        }
     }
 
     void BlendEquation(GLenum mode SOURCE_LOCATION)
@@ -211,6 +272,14 @@ namespace GL
 
     void BlendFunc(GLenum sfactor, GLenum dfactor SOURCE_LOCATION)
     {
+        if (gStateCache.BlendSrcFactor == sfactor && gStateCache.BlendDstFactor == dfactor)
+        {
+            ++gStateCache.Stats.Elided;
+            return;
+        }
+        gStateCache.BlendSrcFactor = sfactor;
+        gStateCache.BlendDstFactor = dfactor;
+        ++gStateCache.Stats.Issued;
         glCheck(glBlendFunc(sfactor, dfactor));
     }
 
@@ -251,6 +320,11 @@ namespace GL
 
     void DeleteProgram(GLuint program SOURCE_LOCATION)
     {
+        // A deleted program stays current until something else is bound, so just forget it
+        if (program != 0 && gStateCache.Program == program)
+        {
+            gStateCache.Program = UNKNOWN;
+        }
         glCheck(glDeleteProgram(program));
     }
 
@@ -261,6 +335,17 @@ namespace GL
 
     void DeleteTextures(GLsizei n, const GLuint* textures SOURCE_LOCATION)
     {
+        // Deleting a bound texture reverts every unit it was bound to back to 0
+        for (GLsizei i = 0; i < n; ++i)
+        {
+            for (auto& bound : gStateCache.Texture2D)
+            {
+                if (textures[i] != 0 && bound == textures[i])
+                {
+                    bound = 0;
+                }
+            }
+        }
         glCheck(glDeleteTextures(n, textures));
     }
 
@@ -271,6 +356,10 @@ namespace GL
 
     void Disable(GLenum cap SOURCE_LOCATION)
     {
+        if (cap == GL_BLEND && !state_changes(gStateCache.Blend, GL_FALSE))
+        {
+            return;
+        }
         glCheck(glDisable(cap));
     }
 
@@ -291,6 +380,10 @@ namespace GL
 
     void Enable(GLenum cap SOURCE_LOCATION)
     {
+        if (cap == GL_BLEND && !state_changes(gStateCache.Blend, GL_TRUE))
+        {
+            return;
+        }
         glCheck(glEnable(cap));
     }
 
@@ -546,7 +639,10 @@ namespace GL
 
     void UseProgram(GLuint program SOURCE_LOCATION)
     {
-        glCheck(glUseProgram(program));
+        if (state_changes(gStateCache.Program, program))
+        {
+            glCheck(glUseProgram(program));
+        }
     }
 
     void ClearDepth(GLdouble depth SOURCE_LOCATION)
@@ -761,6 +857,15 @@ namespace GL
 
     void Viewport(GLint x, GLint y, GLsizei width, GLsizei height SOURCE_LOCATION)
     {
+        const std::array<GLint, 4> viewport{ x, y, width, height };
+        if (gStateCache.ViewportKnown && gStateCache.Viewport == viewport)
+        {
+            ++gStateCache.Stats.Elided;
+            return;
+        }
+        gStateCache.Viewport      = viewport;
+        gStateCache.ViewportKnown = true;
+        ++gStateCache.Stats.Issued;
         glCheck(glViewport(x, y, width, height));
     }
 
@@ -772,6 +877,30 @@ namespace GL
 
     void BindFramebuffer(GLenum target, GLuint framebuffer SOURCE_LOCATION)
     {
+        bool changed = true;
+        switch (target)
+        {
+            case GL_FRAMEBUFFER:
+                changed                     = gStateCache.DrawFramebuffer != framebuffer || gStateCache.ReadFramebuffer != framebuffer;
+                gStateCache.DrawFramebuffer = framebuffer;
+                gStateCache.ReadFramebuffer = framebuffer;
+                break;
+            case GL_DRAW_FRAMEBUFFER:
+                changed                     = gStateCache.DrawFramebuffer != framebuffer;
+                gStateCache.DrawFramebuffer = framebuffer;
+                break;
+            case GL_READ_FRAMEBUFFER:
+                changed                     = gStateCache.ReadFramebuffer != framebuffer;
+                gStateCache.ReadFramebuffer = framebuffer;
+                break;
+            default: break;
+        }
+        if (!changed)
+        {
+            ++gStateCache.Stats.Elided;
+            return;
+        }
+        ++gStateCache.Stats.Issued;
         glCheck(glBindFramebuffer(target, framebuffer));
     }
 
@@ -782,16 +911,37 @@ namespace GL
 
     void BindVertexArray(GLuint array SOURCE_LOCATION)
     {
-        glCheck(glBindVertexArray(array));
+        if (state_changes(gStateCache.VertexArray, array))
+        {
+            glCheck(glBindVertexArray(array));
+        }
     }
 
     void DeleteFramebuffers(GLsizei n, GLuint* framebuffers SOURCE_LOCATION)
     {
+        // Deleting a bound framebuffer reverts that binding to the default framebuffer
+        for (GLsizei i = 0; i < n; ++i)
+        {
+            if (framebuffers[i] == 0)
+                continue;
+            if (gStateCache.DrawFramebuffer == framebuffers[i])
+                gStateCache.DrawFramebuffer = 0;
+            if (gStateCache.ReadFramebuffer == framebuffers[i])
+                gStateCache.ReadFramebuffer = 0;
+        }
         glCheck(glDeleteFramebuffers(n, framebuffers));
     }
 
     void DeleteVertexArrays(GLsizei n, const GLuint* arrays SOURCE_LOCATION)
     {
+        // Deleting the bound vertex array reverts the binding to 0
+        for (GLsizei i = 0; i < n; ++i)
+        {
+            if (arrays[i] != 0 && gStateCache.VertexArray == arrays[i])
+            {
+                gStateCache.VertexArray = 0;
+            }
+        }
         glCheck(glDeleteVertexArrays(n, arrays));
     }
 
@@ -1232,6 +1382,18 @@ namespace GL
         glCheck(glTexStorage2D(target, levels, internalformat, width, height));
     }
 
+    StateCacheStats GetStateCacheStats() noexcept
+    {
+        return gStateCache.Stats;
+    }
+
+    void InvalidateStateCache() noexcept
+    {
+        const auto stats = gStateCache.Stats;
+        gStateCache       = StateCache{};
+        gStateCache.Stats = stats;
+    }
+
 #if !defined(IS_WEBGL2)
 
     // OpenGL 4.3+ Debug functions
@@ -258,6 +258,21 @@ namespace GL
     void DebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled SOURCE_LOCATION);
 
 
+    // Redundant state filtering
+    // UseProgram, BindVertexArray, ActiveTexture, BindTexture(GL_TEXTURE_2D), BindFramebuffer,
+    // Enable/Disable(GL_BLEND), BlendFunc and Viewport skip the driver when the value would not change.
+    struct StateCacheStats
+    {
+        uint64_t Issued = 0; // filtered calls that reached the driver
+        uint64_t Elided = 0; // filtered calls skipped because nothing would change
+    };
+
+    // Running totals since startup; diff two reads for a per-frame count
+    StateCacheStats GetStateCacheStats() noexcept;
+
+    // Forget the tracked state after code outside GL:: (e.g. a third-party backend) may have changed it
+    void InvalidateStateCache() noexcept;
+
 }
 
 #undef SOURCE_LOCATION
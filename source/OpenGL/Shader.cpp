@@ -52,6 +52,15 @@ namespace OpenGL
         shader.UniformLocations.clear();
     }
 
+    UniformHandle GetUniform(const CompiledShader& shader, std::string_view name)
+    {
+        if (const auto it = shader.UniformLocations.find(std::string(name)); it != shader.UniformLocations.end())
+        {
+            return UniformHandle{ it->second };
+        }
+        return UniformHandle{};
+    }
+
     void BindUniformBufferToShader(ShaderHandle shader_handle, GLuint binding_number, Handle uniform_bufer, std::string_view uniform_block_name)
     {
         const auto block_index = GL::GetUniformBlockIndex(shader_handle, uniform_block_name.data());
@@ -63,6 +63,35 @@ namespace OpenGL
         std::unordered_map<std::string, GLint> UniformLocations;
     };
 
+    /**
+     * \brief Pre-resolved location of a single uniform in a compiled shader
+     *
+     * Resolve handles once with GetUniform() after CreateShader() and keep them next to the
+     * shader, so per-draw uniform updates pass a plain GLint instead of hashing a name.
+     * A handle for a uniform the linker removed (or that never existed) stays at -1, which
+     * OpenGL silently ignores in glUniform* calls.
+     */
+    struct UniformHandle
+    {
+        GLint Location = -1;
+
+        [[nodiscard]] bool IsValid() const noexcept
+        {
+            return Location >= 0;
+        }
+    };
+
+    /**
+     * \brief Look up a uniform handle from a compiled shader's location cache
+     * \param shader Compiled shader whose UniformLocations were filled by CreateShader()
+     * \param name Uniform name as reported by the linker (array elements use "name[0]")
+     * \return Handle to the uniform, or an invalid handle if the shader has no such active uniform
+     *
+     * Intended for initialization code; the returned handle is only meaningful for this shader
+     * and must be re-resolved if the shader is recreated.
+     */
+    [[nodiscard]] UniformHandle GetUniform(const CompiledShader& shader, std::string_view name);
+
     /**
      * \brief Create shader program from vertex and fragment shader files
      * \param vertex_filepath Path to the vertex shader source file (.vert)
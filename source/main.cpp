@@ -5,25 +5,109 @@
  * \copyright DigiPen Institute of Technology
  */
 
+#include "Engine/AffineBench.hpp"
 #include "Engine/Engine.hpp"
 #include "Engine/Error.hpp"
+#include "Engine/GameObjectManager.hpp"
 #include "Engine/GameStateManager.hpp"
+#include "Engine/Logger.hpp"
+#include "Engine/Physics/SegmentSoABench.hpp"
 #include "Engine/Window.hpp"
 #include "Game/MainMenu.hpp"
 #include "Game/Mode1.hpp"
+#include "Game/Mode3.hpp"
 #include "Game/Boss1.hpp"
 #include "Engine/SettingsManager.hpp"
 #include "Game/LevelEditor.hpp"
 #include "Game/OriMode.hpp"
 #include "Game/PauseMenu.hpp"
 #include "Game/Splash.hpp"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <limits>
+#include <string_view>
 
 namespace
 {
     [[maybe_unused]] int  gWindowWidth  = 400;
     [[maybe_unused]] int  gWindowHeight = 400;
     [[maybe_unused]] bool gNeedResize   = false;
+
+    // Value of a --name=value argument, empty when it is not on the command line
+    [[maybe_unused]] std::string_view GetArgument(int argc, char* argv[], std::string_view prefix)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            if (arg.starts_with(prefix))
+                return arg.substr(prefix.size());
+        }
+        return {};
+    }
+
+    // --record=file / --replay=file: capture or play back per-frame input and dt (see Engine/InputRecording.hpp)
+    [[maybe_unused]] bool StartInputCapture(Engine& engine, int argc, char* argv[])
+    {
+        if (const std::string_view path = GetArgument(argc, argv, "--replay="); !path.empty())
+            return engine.StartReplay(std::string(path));
+        if (const std::string_view path = GetArgument(argc, argv, "--record="); !path.empty())
+            return engine.StartRecording(std::string(path));
+        return false;
+    }
+
+    [[maybe_unused]] bool HasArgument(int argc, char* argv[], std::string_view wanted)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (wanted == argv[i])
+                return true;
+        }
+        return false;
+    }
+
+    // --headless [--frames=N] [--dt=seconds] [--replay=file] [--bench-rays]
+    // Ticks Mode3 N times with a fixed dt and no window, then prints how long the simulation took.
+    // With --replay the recorded dt and input drive every frame and the run ends with the recording.
+    [[maybe_unused]] int RunHeadless(int argc, char* argv[])
+    {
+        const bool replaying = !GetArgument(argc, argv, "--replay=").empty();
+        long long  frames    = replaying ? std::numeric_limits<long long>::max() : 3600;
+        double     dt        = 1.0 / 60.0;
+        if (const std::string_view value = GetArgument(argc, argv, "--frames="); !value.empty())
+            frames = std::stoll(std::string(value));
+        if (const std::string_view value = GetArgument(argc, argv, "--dt="); !value.empty())
+            dt = std::stod(std::string(value));
+
+        Engine& engine = Engine::Instance();
+        engine.StartHeadless({ 1280, 720 }, dt);
+        engine.AddFont("Assets/fonts/Elara-Bold.png");
+        engine.AddFont("Assets/fonts/Elara-Bold.png");
+        CS230::SettingsManager::Instance().LoadSettings();
+        StartInputCapture(engine, argc, argv);
+        engine.GetGameStateManager().PushState<Mode3>();
+
+        const auto start = std::chrono::steady_clock::now();
+        long long  ran   = 0;
+        while (ran < frames && !engine.HasGameEnded())
+        {
+            engine.Update();
+            ++ran;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (HasArgument(argc, argv, "--bench-rays"))
+        {
+            if (auto gom = engine.GetGameStateManager().GetGSComponent<CS230::GameObjectManager>())
+            {
+                Physics::BenchmarkRayKernel(gom->GetTerrainSegments().GetSegments());
+            }
+        }
+        engine.Stop();
+
+        std::cout << "headless: " << ran << " frames (" << Engine::GetWindowEnvironment().ElapsedTime << "s simulated) in " << seconds << "s wall, " << (seconds * 1000.0 / static_cast<double>(std::max(ran, 1LL)))
+                  << " ms/frame, " << (seconds > 0.0 ? static_cast<double>(ran) / seconds : 0.0) << " frames/s\n";
+        return 0;
+    }
 }
 
 #if defined(__EMSCRIPTEN__)
@@ -72,6 +156,17 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 {
     try
     {
+#if !defined(__EMSCRIPTEN__)
+        if (HasArgument(argc, argv, "--bench-math"))
+        {
+            return Math::BenchmarkAffine();
+        }
+        if (HasArgument(argc, argv, "--headless"))
+        {
+            return RunHeadless(argc, argv);
+        }
+#endif
+
         Engine& engine = Engine::Instance();
         engine.Start("OLLIM");
 
@@ -80,7 +175,24 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 
         CS230::SettingsManager::Instance().LoadSettings();  // applies volume from settings.cfg
 
+        // --renderer=immediate|batch|instanced overrides the Renderer key in settings.cfg for this run only;
+        // it goes straight to the engine so a later SaveSettings() does not write it back
+        if (const std::string_view renderer = GetArgument(argc, argv, "--renderer="); !renderer.empty())
+        {
+            if (const auto type = ParseRenderer2DType(renderer))
+            {
+                engine.SetRenderer2D(*type);
+            }
+            else
+            {
+                Engine::GetLogger().LogError("Unknown --renderer=" + std::string(renderer) + "; expected immediate, batch or instanced. Keeping the Renderer from settings.cfg.");
+            }
+        }
+
         engine.GetGameStateManager().SetPauseState<PauseMenu>();
+#if !defined(__EMSCRIPTEN__)
+        StartInputCapture(engine, argc, argv);
+#endif
 
 #ifdef DEVELOPER_VERSION
         // Dev mode: jump straight into the Level Editor
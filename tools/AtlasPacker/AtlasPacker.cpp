@@ -0,0 +1,491 @@
+/**
+ * \file
+ * \author Sungwoo Yang
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+// Build-time tool: packs the animation frames listed in a clip file into a few power-of-two atlases
+// and writes the index the game loads in place of the loose source images.
+//
+// usage: AtlasPacker <clip file> <source dir> <output dir> <name>
+//
+// Clip file lines (# starts a comment):
+//   CLIP  <name> <fps> <loop 0|1> <scale>
+//   FRAME <png relative to source dir> <x> <y> <w> <h>
+//
+// Writes <output dir>/<name>_<n>.png and <output dir>/<name>.txt:
+//   ATLAS <png relative to output dir> <width> <height>
+//   CLIP  <name> <fps> <loop 0|1> <scale>
+//   FRAME <atlas index> <x> <y> <w> <h>
+// Rectangles use a top-left origin in pixels, the same convention Texture::Draw takes.
+
+#include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr int max_atlas_size = 2048;
+    // Transparent gap between frames so linear filtering never picks up a neighbour
+    constexpr int padding = 2;
+
+    struct Rect
+    {
+        int x = 0;
+        int y = 0;
+        int w = 0;
+        int h = 0;
+
+        int Right() const
+        {
+            return x + w;
+        }
+
+        int Bottom() const
+        {
+            return y + h;
+        }
+
+        bool Contains(const Rect& other) const
+        {
+            return other.x >= x && other.y >= y && other.Right() <= Right() && other.Bottom() <= Bottom();
+        }
+
+        bool Overlaps(const Rect& other) const
+        {
+            return other.x < Right() && x < other.Right() && other.y < Bottom() && y < other.Bottom();
+        }
+    };
+
+    struct SourceFrame
+    {
+        std::string png;
+        Rect        crop;
+
+        auto Key() const
+        {
+            return std::make_tuple(png, crop.x, crop.y, crop.w, crop.h);
+        }
+    };
+
+    struct Clip
+    {
+        std::string         name;
+        float               fps   = 30.0f;
+        int                 loop  = 1;
+        float               scale = 1.0f;
+        std::vector<size_t> frames; // indices into the de-duplicated frame list
+    };
+
+    struct Placement
+    {
+        size_t atlas = 0;
+        Rect   rect;
+    };
+
+    // MaxRects bin packer with the best-short-side-fit heuristic (Jukka Jylänki, "A Thousand Ways to Pack the Bin")
+    class MaxRectsBin
+    {
+    public:
+        explicit MaxRectsBin(int size) : free_rects{ Rect{ 0, 0, size, size } }
+        {
+        }
+
+        std::optional<Rect> Insert(int w, int h)
+        {
+            std::optional<Rect> best;
+            int                 best_short = 0;
+            int                 best_long  = 0;
+            for (const Rect& free_rect : free_rects)
+            {
+                if (free_rect.w < w || free_rect.h < h)
+                {
+                    continue;
+                }
+                const int leftover_x = free_rect.w - w;
+                const int leftover_y = free_rect.h - h;
+                const int short_side = std::min(leftover_x, leftover_y);
+                const int long_side  = std::max(leftover_x, leftover_y);
+                if (!best || short_side < best_short || (short_side == best_short && long_side < best_long))
+                {
+                    best       = Rect{ free_rect.x, free_rect.y, w, h };
+                    best_short = short_side;
+                    best_long  = long_side;
+                }
+            }
+
+            if (best)
+            {
+                Place(*best);
+            }
+            return best;
+        }
+
+        int UsedWidth() const
+        {
+            return used_width;
+        }
+
+        int UsedHeight() const
+        {
+            return used_height;
+        }
+
+    private:
+        void Place(const Rect& used)
+        {
+            std::vector<Rect> next;
+            next.reserve(free_rects.size() + 4);
+            for (const Rect& free_rect : free_rects)
+            {
+                if (!free_rect.Overlaps(used))
+                {
+                    next.push_back(free_rect);
+                    continue;
+                }
+                // Keep the maximal pieces of free_rect on each side of the used area
+                if (used.x > free_rect.x)
+                {
+                    next.push_back({ free_rect.x, free_rect.y, used.x - free_rect.x, free_rect.h });
+                }
+                if (used.Right() < free_rect.Right())
+                {
+                    next.push_back({ used.Right(), free_rect.y, free_rect.Right() - used.Right(), free_rect.h });
+                }
+                if (used.y > free_rect.y)
+                {
+                    next.push_back({ free_rect.x, free_rect.y, free_rect.w, used.y - free_rect.y });
+                }
+                if (used.Bottom() < free_rect.Bottom())
+                {
+                    next.push_back({ free_rect.x, used.Bottom(), free_rect.w, free_rect.Bottom() - used.Bottom() });
+                }
+            }
+
+            // Drop free rectangles that are covered by another one
+            free_rects.clear();
+            for (size_t i = 0; i < next.size(); ++i)
+            {
+                bool redundant = false;
+                for (size_t j = 0; j < next.size() && !redundant; ++j)
+                {
+                    if (i != j && next[j].Contains(next[i]) && (!next[i].Contains(next[j]) || j < i))
+                    {
+                        redundant = true;
+                    }
+                }
+                if (!redundant)
+                {
+                    free_rects.push_back(next[i]);
+                }
+            }
+
+            used_width  = std::max(used_width, used.Right());
+            used_height = std::max(used_height, used.Bottom());
+        }
+
+        std::vector<Rect> free_rects;
+        int               used_width  = 0;
+        int               used_height = 0;
+    };
+
+    struct Image
+    {
+        int            width  = 0;
+        int            height = 0;
+        unsigned char* pixels = nullptr;
+    };
+
+    int NextPowerOfTwo(int value)
+    {
+        int result = 1;
+        while (result < value)
+        {
+            result *= 2;
+        }
+        return result;
+    }
+
+    bool ReadClips(const std::filesystem::path& path, std::vector<SourceFrame>& frames, std::vector<Clip>& clips)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            std::cerr << "AtlasPacker: cannot open " << path << "\n";
+            return false;
+        }
+
+        std::map<decltype(std::declval<SourceFrame>().Key()), size_t> frame_lookup;
+        std::string                                                   line;
+        int                                                           line_number = 0;
+        while (std::getline(file, line))
+        {
+            ++line_number;
+            if (line.empty() || line[0] == '#' || line[0] == '\r')
+            {
+                continue;
+            }
+
+            std::istringstream ss(line);
+            std::string        cmd;
+            ss >> cmd;
+            if (cmd == "CLIP")
+            {
+                Clip clip;
+                ss >> clip.name >> clip.fps >> clip.loop >> clip.scale;
+                if (ss.fail())
+                {
+                    std::cerr << path.string() << ":" << line_number << ": malformed CLIP line\n";
+                    return false;
+                }
+                clips.push_back(std::move(clip));
+            }
+            else if (cmd == "FRAME")
+            {
+                SourceFrame frame;
+                ss >> frame.png >> frame.crop.x >> frame.crop.y >> frame.crop.w >> frame.crop.h;
+                if (ss.fail() || clips.empty() || frame.crop.x < 0 || frame.crop.y < 0 || frame.crop.w <= 0 || frame.crop.h <= 0)
+                {
+                    std::cerr << path.string() << ":" << line_number << ": malformed FRAME line or FRAME before any CLIP\n";
+                    return false;
+                }
+
+                // Clips share frames (and the source data repeats some crops), so each crop is packed once
+                auto [it, inserted] = frame_lookup.try_emplace(frame.Key(), frames.size());
+                if (inserted)
+                {
+                    frames.push_back(frame);
+                }
+                clips.back().frames.push_back(it->second);
+            }
+            else
+            {
+                std::cerr << path.string() << ":" << line_number << ": unknown command '" << cmd << "'\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Largest frames first; ties keep file order so the output is stable between runs
+    std::vector<size_t> PackingOrder(const std::vector<SourceFrame>& frames)
+    {
+        std::vector<size_t> order(frames.size());
+        std::iota(order.begin(), order.end(), size_t{ 0 });
+        std::stable_sort(
+            order.begin(), order.end(),
+            [&frames](size_t a, size_t b)
+            {
+                const Rect& ra = frames[a].crop;
+                const Rect& rb = frames[b].crop;
+                return std::max(ra.w, ra.h) > std::max(rb.w, rb.h) || (std::max(ra.w, ra.h) == std::max(rb.w, rb.h) && ra.w * ra.h > rb.w * rb.h);
+            });
+        return order;
+    }
+
+    bool Pack(const std::vector<SourceFrame>& frames, std::vector<Placement>& placements, std::vector<MaxRectsBin>& bins)
+    {
+        placements.resize(frames.size());
+        for (const size_t index : PackingOrder(frames))
+        {
+            const Rect& crop = frames[index].crop;
+            if (crop.w + padding > max_atlas_size || crop.h + padding > max_atlas_size)
+            {
+                std::cerr << "AtlasPacker: " << frames[index].png << " crop " << crop.w << "x" << crop.h << " does not fit a " << max_atlas_size << " atlas\n";
+                return false;
+            }
+
+            bool placed = false;
+            for (size_t b = 0; b < bins.size() && !placed; ++b)
+            {
+                if (const auto rect = bins[b].Insert(crop.w + padding, crop.h + padding))
+                {
+                    placements[index] = { b, { rect->x, rect->y, crop.w, crop.h } };
+                    placed            = true;
+                }
+            }
+            if (!placed)
+            {
+                bins.emplace_back(max_atlas_size);
+                const auto rect   = bins.back().Insert(crop.w + padding, crop.h + padding);
+                placements[index] = { bins.size() - 1, { rect->x, rect->y, crop.w, crop.h } };
+            }
+        }
+        return true;
+    }
+
+    bool WriteAtlases(
+        const std::vector<SourceFrame>& frames, const std::vector<Placement>& placements, const std::vector<MaxRectsBin>& bins, const std::filesystem::path& source_dir,
+        const std::filesystem::path& output_dir, const std::string& name, std::vector<std::pair<int, int>>& atlas_sizes)
+    {
+        std::map<std::string, Image> sources;
+        bool                         ok = true;
+
+        std::vector<std::vector<unsigned char>> atlases;
+        for (const MaxRectsBin& bin : bins)
+        {
+            const int width  = NextPowerOfTwo(bin.UsedWidth());
+            const int height = NextPowerOfTwo(bin.UsedHeight());
+            atlas_sizes.emplace_back(width, height);
+            atlases.emplace_back(static_cast<size_t>(width) * static_cast<size_t>(height) * 4, static_cast<unsigned char>(0));
+        }
+
+        for (size_t i = 0; i < frames.size() && ok; ++i)
+        {
+            const SourceFrame& frame = frames[i];
+            auto [it, inserted]      = sources.try_emplace(frame.png);
+            Image& source            = it->second;
+            if (inserted)
+            {
+                int channels  = 0;
+                source.pixels = stbi_load((source_dir / frame.png).string().c_str(), &source.width, &source.height, &channels, 4);
+                if (source.pixels == nullptr)
+                {
+                    std::cerr << "AtlasPacker: cannot load " << (source_dir / frame.png).string() << ": " << stbi_failure_reason() << "\n";
+                    ok = false;
+                    break;
+                }
+            }
+
+            const Placement& placement = placements[i];
+            const int        atlas_w   = atlas_sizes[placement.atlas].first;
+            auto&            atlas     = atlases[placement.atlas];
+
+            // Crops that run past the source image keep the transparent fill for the missing part,
+            // but one that misses the image entirely would ship a blank frame
+            const int copy_w = std::min(frame.crop.w, source.width - frame.crop.x);
+            const int copy_h = std::min(frame.crop.h, source.height - frame.crop.y);
+            if (copy_w <= 0 || copy_h <= 0)
+            {
+                std::cerr << "AtlasPacker: " << frame.png << " crop " << frame.crop.x << "," << frame.crop.y << " lies outside the " << source.width << "x" << source.height << " image\n";
+                ok = false;
+                break;
+            }
+            if (copy_w < frame.crop.w || copy_h < frame.crop.h)
+            {
+                std::cerr << "AtlasPacker: warning: " << frame.png << " crop extends past the image\n";
+            }
+            for (int row = 0; row < copy_h; ++row)
+            {
+                const size_t src = (static_cast<size_t>(frame.crop.y + row) * static_cast<size_t>(source.width) + static_cast<size_t>(frame.crop.x)) * 4;
+                const size_t dst = (static_cast<size_t>(placement.rect.y + row) * static_cast<size_t>(atlas_w) + static_cast<size_t>(placement.rect.x)) * 4;
+                std::copy_n(source.pixels + src, static_cast<size_t>(copy_w) * 4, atlas.begin() + static_cast<std::ptrdiff_t>(dst));
+            }
+        }
+
+        for (auto& [png, source] : sources)
+        {
+            stbi_image_free(source.pixels);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+
+        for (size_t a = 0; a < atlases.size(); ++a)
+        {
+            const auto path = output_dir / (name + "_" + std::to_string(a) + ".png");
+            const auto [w, h] = atlas_sizes[a];
+            if (stbi_write_png(path.string().c_str(), w, h, 4, atlases[a].data(), w * 4) == 0)
+            {
+                std::cerr << "AtlasPacker: cannot write " << path.string() << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool WriteIndex(
+        const std::vector<Clip>& clips, const std::vector<Placement>& placements, const std::vector<std::pair<int, int>>& atlas_sizes, const std::filesystem::path& output_dir,
+        const std::string& name)
+    {
+        const auto    path = output_dir / (name + ".txt");
+        std::ofstream file(path);
+        if (!file.is_open())
+        {
+            std::cerr << "AtlasPacker: cannot write " << path.string() << "\n";
+            return false;
+        }
+
+        file << "# Generated by AtlasPacker - edit the clip file and rebuild instead\n";
+        for (size_t a = 0; a < atlas_sizes.size(); ++a)
+        {
+            file << "ATLAS " << name << "_" << a << ".png " << atlas_sizes[a].first << " " << atlas_sizes[a].second << "\n";
+        }
+        for (const Clip& clip : clips)
+        {
+            file << "CLIP " << clip.name << " " << clip.fps << " " << clip.loop << " " << clip.scale << "\n";
+            for (const size_t index : clip.frames)
+            {
+                const Placement& p = placements[index];
+                file << "FRAME " << p.atlas << " " << p.rect.x << " " << p.rect.y << " " << p.rect.w << " " << p.rect.h << "\n";
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 5)
+    {
+        std::cerr << "usage: AtlasPacker <clip file> <source dir> <output dir> <name>\n";
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path clip_file  = argv[1];
+    const std::filesystem::path source_dir = argv[2];
+    const std::filesystem::path output_dir = argv[3];
+    const std::string           name       = argv[4];
+
+    std::vector<SourceFrame> frames;
+    std::vector<Clip>        clips;
+    if (!ReadClips(clip_file, frames, clips))
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Placement>   placements;
+    std::vector<MaxRectsBin> bins;
+    if (!Pack(frames, placements, bins))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Clear out atlases from a previous run that may have needed more pages
+    std::filesystem::create_directories(output_dir);
+    for (const auto& entry : std::filesystem::directory_iterator(output_dir))
+    {
+        const std::string file_name = entry.path().filename().string();
+        if (file_name.starts_with(name + "_") && entry.path().extension() == ".png")
+        {
+            std::filesystem::remove(entry.path());
+        }
+    }
+
+    std::vector<std::pair<int, int>> atlas_sizes;
+    if (!WriteAtlases(frames, placements, bins, source_dir, output_dir, name, atlas_sizes) || !WriteIndex(clips, placements, atlas_sizes, output_dir, name))
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "AtlasPacker: " << frames.size() << " frames from " << clip_file.filename().string() << " into " << atlas_sizes.size() << " atlas(es)\n";
+    return EXIT_SUCCESS;
+}